@@ -0,0 +1,2935 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+// All shipped targets are little-endian, so wire loads and stores compile to
+// single unaligned memcpys there; the byte-swizzling fallback is kept only
+// for big-endian builds.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define FFIRE_LITTLE_ENDIAN 1
+#else
+#define FFIRE_LITTLE_ENDIAN 0
+#endif
+
+// Exception availability. Under -fno-exceptions every would-be throw
+// becomes std::abort(); the validate-first entry points
+// (decode_plugin_message_nothrow, decode_plugin_message_trusted) never
+// reach it on malformed input, so they are the ones to use there.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || \
+    (defined(_MSC_VER) && defined(_CPPUNWIND))
+#define FFIRE_EXCEPTIONS 1
+#else
+#define FFIRE_EXCEPTIONS 0
+#endif
+
+namespace test {
+
+struct Plugin;
+struct Parameter;
+
+namespace detail {
+
+// Single funnel for fatal wire errors: throws where exceptions exist,
+// aborts under -fno-exceptions. Callers that must not abort go through
+// the validate-first entry points instead.
+[[noreturn]] inline void raise_decode_error(const char* msg) {
+#if FFIRE_EXCEPTIONS
+    throw std::runtime_error(msg);
+#else
+    (void)msg;
+    std::abort();
+#endif
+}
+
+} // namespace detail
+
+struct Parameter {
+    std::string DisplayName;
+    float DefaultValue;
+    float CurrentValue;
+    int32_t Address;
+    float MaxValue;
+    float MinValue;
+    std::string Unit;
+    std::string Identifier;
+    bool CanRamp;
+    bool IsWritable;
+    int64_t RawFlags;
+    std::optional<std::vector<std::string>> IndexedValues;
+    std::optional<std::string> IndexedValuesSource;
+};
+
+struct Plugin {
+    std::string Name;
+    std::string ManufacturerID;
+    std::string Type;
+    std::string Subtype;
+    std::vector<Parameter> Parameters;
+};
+
+// Arena-aware mirrors of Parameter and Plugin. All strings and vectors use
+// std::pmr allocators, so a whole decoded message can live in one bump
+// arena and be released in a single step instead of element by element.
+namespace pmr {
+
+struct Parameter {
+    explicit Parameter(std::pmr::memory_resource* mr)
+        : DisplayName(mr), Unit(mr), Identifier(mr) {}
+
+    std::pmr::string DisplayName;
+    float DefaultValue = 0.0f;
+    float CurrentValue = 0.0f;
+    int32_t Address = 0;
+    float MaxValue = 0.0f;
+    float MinValue = 0.0f;
+    std::pmr::string Unit;
+    std::pmr::string Identifier;
+    bool CanRamp = false;
+    bool IsWritable = false;
+    int64_t RawFlags = 0;
+    std::optional<std::pmr::vector<std::pmr::string>> IndexedValues;
+    std::optional<std::pmr::string> IndexedValuesSource;
+};
+
+struct Plugin {
+    explicit Plugin(std::pmr::memory_resource* mr)
+        : Name(mr), ManufacturerID(mr), Type(mr), Subtype(mr), Parameters(mr) {}
+
+    std::pmr::string Name;
+    std::pmr::string ManufacturerID;
+    std::pmr::string Type;
+    std::pmr::string Subtype;
+    std::pmr::vector<Parameter> Parameters;
+};
+
+} // namespace pmr
+
+// Compile-time layout traits: fixed-width byte counts of each record that
+// are independent of any string or array contents.
+struct ParameterLayout {
+    static constexpr size_t LengthPrefix = 2;  // string / array length
+    static constexpr size_t Marker = 1;        // optional presence byte
+    static constexpr size_t ScalarBlock = 20;  // DefaultValue..MinValue
+    static constexpr size_t FlagBlock = 10;    // CanRamp..RawFlags
+    // Three string prefixes, both fixed blocks and both optional markers.
+    static constexpr size_t FixedBytes =
+        3 * LengthPrefix + ScalarBlock + FlagBlock + 2 * Marker;
+    // Presence-bitmap wire mode: one leading byte per record replaces the
+    // per-field markers. Bits are assigned in field order.
+    static constexpr uint8_t IndexedValuesBit = 0x01;
+    static constexpr uint8_t IndexedValuesSourceBit = 0x02;
+};
+
+struct PluginLayout {
+    static constexpr size_t LengthPrefix = 2;
+    // Four string prefixes plus the Parameters array length.
+    static constexpr size_t FixedBytes = 5 * LengthPrefix;
+};
+
+// Wide-length twins: identical records with u32 string/array prefixes, for
+// the opt-in wire mode that lifts the 65535-element ceiling.
+struct ParameterLayoutWide {
+    static constexpr size_t LengthPrefix = 4;
+    static constexpr size_t FixedBytes =
+        3 * LengthPrefix + ParameterLayout::ScalarBlock +
+        ParameterLayout::FlagBlock + 2 * ParameterLayout::Marker;
+};
+
+struct PluginLayoutWide {
+    static constexpr size_t LengthPrefix = 4;
+    static constexpr size_t FixedBytes = 5 * LengthPrefix;
+};
+
+#if FFIRE_LITTLE_ENDIAN
+// Packed mirrors of the maximal fixed-width runs inside Parameter. On
+// little-endian builds a whole run moves with one bounds check and one
+// memcpy instead of a checked call per field.
+#pragma pack(push, 1)
+struct ParameterScalarBlock {
+    float DefaultValue;
+    float CurrentValue;
+    int32_t Address;
+    float MaxValue;
+    float MinValue;
+};
+struct ParameterFlagBlock {
+    uint8_t CanRamp;
+    uint8_t IsWritable;
+    int64_t RawFlags;
+};
+#pragma pack(pop)
+static_assert(sizeof(ParameterScalarBlock) == ParameterLayout::ScalarBlock,
+              "packed block must match wire layout");
+static_assert(sizeof(ParameterFlagBlock) == ParameterLayout::FlagBlock,
+              "packed block must match wire layout");
+#endif
+
+// Exact encoded size of a record; mirrors encode_plugin_message field for
+// field. Templated over the struct family so the std:: and std::pmr::
+// mirrors share one walk; Wide selects the u32-prefix wire mode.
+namespace detail {
+
+template <bool Wide = false, bool Packed = false, typename ParameterT>
+inline size_t parameter_encoded_size(const ParameterT& value) {
+    // Packed trades the two per-field markers for one leading bitmap byte.
+    constexpr size_t fixed =
+        (Wide ? ParameterLayoutWide::FixedBytes : ParameterLayout::FixedBytes) -
+        (Packed ? ParameterLayout::Marker : 0);
+    constexpr size_t prefix =
+        Wide ? ParameterLayoutWide::LengthPrefix : ParameterLayout::LengthPrefix;
+    size_t size = fixed + value.DisplayName.size() +
+                  value.Unit.size() + value.Identifier.size();
+    if (value.IndexedValues.has_value()) {
+        size += prefix;
+        for (const auto& elem : value.IndexedValues.value()) {
+            size += prefix + elem.size();
+        }
+    }
+    if (value.IndexedValuesSource.has_value()) {
+        size += prefix + value.IndexedValuesSource.value().size();
+    }
+    return size;
+}
+
+template <bool Wide = false, bool Packed = false, typename PluginT>
+inline size_t plugin_encoded_size(const PluginT& value) {
+    constexpr size_t fixed =
+        Wide ? PluginLayoutWide::FixedBytes : PluginLayout::FixedBytes;
+    size_t size = fixed + value.Name.size() +
+                  value.ManufacturerID.size() + value.Type.size() +
+                  value.Subtype.size();
+    for (const auto& elem : value.Parameters) {
+        size += parameter_encoded_size<Wide, Packed>(elem);
+    }
+    return size;
+}
+
+template <bool Wide = false, bool Packed = false, typename PluginVecT>
+inline size_t message_encoded_size(const PluginVecT& value) {
+    size_t size = Wide ? 4 : 2;  // top-level array length
+    for (const auto& elem : value) {
+        size += plugin_encoded_size<Wide, Packed>(elem);
+    }
+    return size;
+}
+
+} // namespace detail
+
+inline size_t encoded_size(const Parameter& value) {
+    return detail::parameter_encoded_size(value);
+}
+inline size_t encoded_size(const Plugin& value) {
+    return detail::plugin_encoded_size(value);
+}
+inline size_t encoded_size(const std::vector<Plugin>& value) {
+    return detail::message_encoded_size(value);
+}
+inline size_t encoded_size(const pmr::Parameter& value) {
+    return detail::parameter_encoded_size(value);
+}
+inline size_t encoded_size(const pmr::Plugin& value) {
+    return detail::plugin_encoded_size(value);
+}
+inline size_t encoded_size(const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::message_encoded_size(value);
+}
+
+// Binary encoder for wire format
+//
+// Two-pass: the buffer is sized to the exact byte count from encoded_size()
+// up front and the write_* methods store through a cursor, so encoding a
+// message performs a single allocation and no reallocation or copying.
+class Encoder {
+public:
+    std::vector<uint8_t> buffer;  // backing storage when self-owned
+    uint8_t* out;
+    size_t pos = 0;
+
+    explicit Encoder(size_t exact_size) : buffer(exact_size), out(buffer.data()) {}
+
+    // Encode into caller-provided storage of at least encoded_size() bytes;
+    // `buffer` stays empty.
+    explicit Encoder(uint8_t* dst) : out(dst) {}
+
+    void write_byte(uint8_t b) { out[pos++] = b; }
+
+    void write_bool(bool v) { out[pos++] = v ? 0x01 : 0x00; }
+
+    void write_int8(int8_t v) { out[pos++] = static_cast<uint8_t>(v); }
+
+    void write_int16(int16_t v) {
+        uint16_t u = static_cast<uint16_t>(v);
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &u, 2);
+#else
+        out[pos] = static_cast<uint8_t>(u);
+        out[pos + 1] = static_cast<uint8_t>(u >> 8);
+#endif
+        pos += 2;
+    }
+
+    void write_int32(int32_t v) {
+        uint32_t u = static_cast<uint32_t>(v);
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &u, 4);
+#else
+        out[pos] = static_cast<uint8_t>(u);
+        out[pos + 1] = static_cast<uint8_t>(u >> 8);
+        out[pos + 2] = static_cast<uint8_t>(u >> 16);
+        out[pos + 3] = static_cast<uint8_t>(u >> 24);
+#endif
+        pos += 4;
+    }
+
+    void write_int64(int64_t v) {
+        uint64_t u = static_cast<uint64_t>(v);
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &u, 8);
+#else
+        out[pos] = static_cast<uint8_t>(u);
+        out[pos + 1] = static_cast<uint8_t>(u >> 8);
+        out[pos + 2] = static_cast<uint8_t>(u >> 16);
+        out[pos + 3] = static_cast<uint8_t>(u >> 24);
+        out[pos + 4] = static_cast<uint8_t>(u >> 32);
+        out[pos + 5] = static_cast<uint8_t>(u >> 40);
+        out[pos + 6] = static_cast<uint8_t>(u >> 48);
+        out[pos + 7] = static_cast<uint8_t>(u >> 56);
+#endif
+        pos += 8;
+    }
+
+    void write_float32(float v) {
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &v, 4);
+        pos += 4;
+#else
+        uint32_t u;
+        std::memcpy(&u, &v, sizeof(float));
+        write_int32(static_cast<int32_t>(u));
+#endif
+    }
+
+    void write_float64(double v) {
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &v, 8);
+        pos += 8;
+#else
+        uint64_t u;
+        std::memcpy(&u, &v, sizeof(double));
+        write_int64(static_cast<int64_t>(u));
+#endif
+    }
+
+    void write_string(std::string_view s) {
+        uint16_t len = static_cast<uint16_t>(s.size());
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &len, 2);
+#else
+        out[pos] = static_cast<uint8_t>(len);
+        out[pos + 1] = static_cast<uint8_t>(len >> 8);
+#endif
+        std::memcpy(out + pos + 2, s.data(), s.size());
+        pos += 2 + s.size();
+    }
+
+    // u32 length prefix for the wide wire mode, which lifts the u16 cap on
+    // string and array sizes.
+    void write_length_wide(size_t n) {
+        uint32_t len = static_cast<uint32_t>(n);
+#if FFIRE_LITTLE_ENDIAN
+        std::memcpy(out + pos, &len, 4);
+#else
+        out[pos] = static_cast<uint8_t>(len);
+        out[pos + 1] = static_cast<uint8_t>(len >> 8);
+        out[pos + 2] = static_cast<uint8_t>(len >> 16);
+        out[pos + 3] = static_cast<uint8_t>(len >> 24);
+#endif
+        pos += 4;
+    }
+
+    void write_string_wide(std::string_view s) {
+        write_length_wide(s.size());
+        std::memcpy(out + pos, s.data(), s.size());
+        pos += s.size();
+    }
+};
+
+// Binary decoder for wire format
+class Decoder {
+public:
+    const uint8_t* data;
+    size_t size;
+    size_t pos = 0;
+
+    Decoder(const uint8_t* d, size_t s) : data(d), size(s) {}
+    Decoder(const std::vector<uint8_t>& v) : data(v.data()), size(v.size()) {}
+
+    void check_remaining(size_t needed) {
+        if (pos + needed > size) {
+            detail::raise_decode_error("insufficient data for decode");
+        }
+    }
+
+    bool read_bool() {
+        check_remaining(1);
+        return data[pos++] != 0x00;
+    }
+
+    int8_t read_int8() {
+        check_remaining(1);
+        return static_cast<int8_t>(data[pos++]);
+    }
+
+    int16_t read_int16() {
+        check_remaining(2);
+#if FFIRE_LITTLE_ENDIAN
+        int16_t v;
+        std::memcpy(&v, data + pos, 2);
+        pos += 2;
+        return v;
+#else
+        uint16_t u = static_cast<uint16_t>(data[pos]) |
+                     (static_cast<uint16_t>(data[pos + 1]) << 8);
+        pos += 2;
+        return static_cast<int16_t>(u);
+#endif
+    }
+
+    int32_t read_int32() {
+        check_remaining(4);
+#if FFIRE_LITTLE_ENDIAN
+        int32_t v;
+        std::memcpy(&v, data + pos, 4);
+        pos += 4;
+        return v;
+#else
+        uint32_t u = static_cast<uint32_t>(data[pos]) |
+                     (static_cast<uint32_t>(data[pos + 1]) << 8) |
+                     (static_cast<uint32_t>(data[pos + 2]) << 16) |
+                     (static_cast<uint32_t>(data[pos + 3]) << 24);
+        pos += 4;
+        return static_cast<int32_t>(u);
+#endif
+    }
+
+    int64_t read_int64() {
+        check_remaining(8);
+#if FFIRE_LITTLE_ENDIAN
+        int64_t v;
+        std::memcpy(&v, data + pos, 8);
+        pos += 8;
+        return v;
+#else
+        uint64_t u = static_cast<uint64_t>(data[pos]) |
+                     (static_cast<uint64_t>(data[pos + 1]) << 8) |
+                     (static_cast<uint64_t>(data[pos + 2]) << 16) |
+                     (static_cast<uint64_t>(data[pos + 3]) << 24) |
+                     (static_cast<uint64_t>(data[pos + 4]) << 32) |
+                     (static_cast<uint64_t>(data[pos + 5]) << 40) |
+                     (static_cast<uint64_t>(data[pos + 6]) << 48) |
+                     (static_cast<uint64_t>(data[pos + 7]) << 56);
+        pos += 8;
+        return static_cast<int64_t>(u);
+#endif
+    }
+
+    float read_float32() {
+#if FFIRE_LITTLE_ENDIAN
+        check_remaining(4);
+        float f;
+        std::memcpy(&f, data + pos, 4);
+        pos += 4;
+        return f;
+#else
+        uint32_t u = static_cast<uint32_t>(read_int32());
+        float f;
+        std::memcpy(&f, &u, sizeof(float));
+        return f;
+#endif
+    }
+
+    double read_float64() {
+#if FFIRE_LITTLE_ENDIAN
+        check_remaining(8);
+        double d;
+        std::memcpy(&d, data + pos, 8);
+        pos += 8;
+        return d;
+#else
+        uint64_t u = static_cast<uint64_t>(read_int64());
+        double d;
+        std::memcpy(&d, &u, sizeof(double));
+        return d;
+#endif
+    }
+
+    // Wire u16 length prefix; shared by strings and array headers.
+    uint16_t read_length() {
+        check_remaining(2);
+#if FFIRE_LITTLE_ENDIAN
+        uint16_t len;
+        std::memcpy(&len, data + pos, 2);
+#else
+        uint16_t len = static_cast<uint16_t>(data[pos]) |
+                       (static_cast<uint16_t>(data[pos + 1]) << 8);
+#endif
+        pos += 2;
+        return len;
+    }
+
+    std::string read_string() {
+        uint16_t len = read_length();
+        check_remaining(len);
+        std::string s(reinterpret_cast<const char*>(data + pos), len);
+        pos += len;
+        return s;
+    }
+
+    std::string_view read_string_view() {
+        uint16_t len = read_length();
+        check_remaining(len);
+        std::string_view s(reinterpret_cast<const char*>(data + pos), len);
+        pos += len;
+        return s;
+    }
+
+    uint16_t read_array_length() { return read_length(); }
+
+    // u32 length prefix for the wide wire mode.
+    uint32_t read_length_wide() {
+        check_remaining(4);
+#if FFIRE_LITTLE_ENDIAN
+        uint32_t len;
+        std::memcpy(&len, data + pos, 4);
+#else
+        uint32_t len = static_cast<uint32_t>(data[pos]) |
+                       (static_cast<uint32_t>(data[pos + 1]) << 8) |
+                       (static_cast<uint32_t>(data[pos + 2]) << 16) |
+                       (static_cast<uint32_t>(data[pos + 3]) << 24);
+#endif
+        pos += 4;
+        return len;
+    }
+
+    std::string read_string_wide() {
+        uint32_t len = read_length_wide();
+        check_remaining(len);
+        std::string s(reinterpret_cast<const char*>(data + pos), len);
+        pos += len;
+        return s;
+    }
+
+    std::string_view read_string_view_wide() {
+        uint32_t len = read_length_wide();
+        check_remaining(len);
+        std::string_view s(reinterpret_cast<const char*>(data + pos), len);
+        pos += len;
+        return s;
+    }
+};
+
+// Unchecked twin of Decoder for pre-validated buffers
+//
+// Same surface as Decoder minus the per-read bounds branch and the
+// exception machinery: check_remaining is a no-op, so the shared decode
+// walks compile down to straight loads. Only hand it a buffer that
+// validate_plugin_message() accepted — every read is trusted.
+class UncheckedDecoder {
+public:
+    const uint8_t* data;
+    size_t size;
+    size_t pos = 0;
+
+    UncheckedDecoder(const uint8_t* d, size_t s) : data(d), size(s) {}
+
+    void check_remaining(size_t) {}
+
+    bool read_bool() { return data[pos++] != 0x00; }
+
+    int8_t read_int8() { return static_cast<int8_t>(data[pos++]); }
+
+    int16_t read_int16() {
+#if FFIRE_LITTLE_ENDIAN
+        int16_t v;
+        std::memcpy(&v, data + pos, 2);
+#else
+        uint16_t u = static_cast<uint16_t>(data[pos]) |
+                     (static_cast<uint16_t>(data[pos + 1]) << 8);
+        int16_t v = static_cast<int16_t>(u);
+#endif
+        pos += 2;
+        return v;
+    }
+
+    int32_t read_int32() {
+#if FFIRE_LITTLE_ENDIAN
+        int32_t v;
+        std::memcpy(&v, data + pos, 4);
+#else
+        uint32_t u = static_cast<uint32_t>(data[pos]) |
+                     (static_cast<uint32_t>(data[pos + 1]) << 8) |
+                     (static_cast<uint32_t>(data[pos + 2]) << 16) |
+                     (static_cast<uint32_t>(data[pos + 3]) << 24);
+        int32_t v = static_cast<int32_t>(u);
+#endif
+        pos += 4;
+        return v;
+    }
+
+    int64_t read_int64() {
+#if FFIRE_LITTLE_ENDIAN
+        int64_t v;
+        std::memcpy(&v, data + pos, 8);
+#else
+        uint64_t u = 0;
+        for (int i = 7; i >= 0; --i) {
+            u = (u << 8) | data[pos + i];
+        }
+        int64_t v = static_cast<int64_t>(u);
+#endif
+        pos += 8;
+        return v;
+    }
+
+    float read_float32() {
+#if FFIRE_LITTLE_ENDIAN
+        float f;
+        std::memcpy(&f, data + pos, 4);
+        pos += 4;
+        return f;
+#else
+        uint32_t u = static_cast<uint32_t>(read_int32());
+        float f;
+        std::memcpy(&f, &u, sizeof(float));
+        return f;
+#endif
+    }
+
+    double read_float64() {
+#if FFIRE_LITTLE_ENDIAN
+        double d;
+        std::memcpy(&d, data + pos, 8);
+        pos += 8;
+        return d;
+#else
+        uint64_t u = static_cast<uint64_t>(read_int64());
+        double d;
+        std::memcpy(&d, &u, sizeof(double));
+        return d;
+#endif
+    }
+
+    uint16_t read_length() {
+#if FFIRE_LITTLE_ENDIAN
+        uint16_t len;
+        std::memcpy(&len, data + pos, 2);
+#else
+        uint16_t len = static_cast<uint16_t>(data[pos]) |
+                       (static_cast<uint16_t>(data[pos + 1]) << 8);
+#endif
+        pos += 2;
+        return len;
+    }
+
+    std::string read_string() {
+        uint16_t len = read_length();
+        std::string s(reinterpret_cast<const char*>(data + pos), len);
+        pos += len;
+        return s;
+    }
+
+    std::string_view read_string_view() {
+        uint16_t len = read_length();
+        std::string_view s(reinterpret_cast<const char*>(data + pos), len);
+        pos += len;
+        return s;
+    }
+
+    uint16_t read_array_length() { return read_length(); }
+};
+
+namespace detail {
+
+// Length-prefix shims for the walk templates below: Wide routes through
+// the u32 prefixes of the wide wire mode, the default stays on the
+// canonical u16 encoding.
+template <bool Wide>
+inline void write_length(Encoder& enc, size_t n) {
+    if constexpr (Wide) {
+        enc.write_length_wide(n);
+    } else {
+        uint16_t len = static_cast<uint16_t>(n);
+        enc.write_byte(static_cast<uint8_t>(len));
+        enc.write_byte(static_cast<uint8_t>(len >> 8));
+    }
+}
+
+template <bool Wide>
+inline void write_string(Encoder& enc, std::string_view s) {
+    if constexpr (Wide) {
+        enc.write_string_wide(s);
+    } else {
+        enc.write_string(s);
+    }
+}
+
+template <bool Wide, typename DecoderT>
+inline size_t read_length(DecoderT& dec) {
+    if constexpr (Wide) {
+        return dec.read_length_wide();
+    } else {
+        return dec.read_length();
+    }
+}
+
+template <bool Wide, typename DecoderT>
+inline std::string read_string(DecoderT& dec) {
+    if constexpr (Wide) {
+        return dec.read_string_wide();
+    } else {
+        return dec.read_string();
+    }
+}
+
+template <bool Wide, typename DecoderT>
+inline std::string_view read_string_view(DecoderT& dec) {
+    if constexpr (Wide) {
+        return dec.read_string_view_wide();
+    } else {
+        return dec.read_string_view();
+    }
+}
+
+// Encode one top-level Plugin element through the encoder; shared by the
+// flat and framed message encoders. Templated so the std:: and std::pmr::
+// struct mirrors share one encode walk; Wide selects the u32-prefix mode,
+// Packed the presence-bitmap optional encoding.
+template <bool Wide = false, bool Packed = false, typename PluginT>
+inline void encode_plugin(Encoder& enc, const PluginT& elem) {
+    write_string<Wide>(enc, elem.Name);
+    write_string<Wide>(enc, elem.ManufacturerID);
+    write_string<Wide>(enc, elem.Type);
+    write_string<Wide>(enc, elem.Subtype);
+    write_length<Wide>(enc, elem.Parameters.size());
+    for (const auto& elem : elem.Parameters) {
+        if constexpr (Packed) {
+            uint8_t present = 0;
+            if (elem.IndexedValues.has_value()) {
+                present |= ParameterLayout::IndexedValuesBit;
+            }
+            if (elem.IndexedValuesSource.has_value()) {
+                present |= ParameterLayout::IndexedValuesSourceBit;
+            }
+            enc.write_byte(present);
+        }
+        write_string<Wide>(enc, elem.DisplayName);
+#if FFIRE_LITTLE_ENDIAN
+        {
+            ParameterScalarBlock blk{elem.DefaultValue, elem.CurrentValue,
+                                     elem.Address, elem.MaxValue, elem.MinValue};
+            std::memcpy(enc.out + enc.pos, &blk, sizeof(blk));
+            enc.pos += sizeof(blk);
+        }
+#else
+        enc.write_float32(elem.DefaultValue);
+        enc.write_float32(elem.CurrentValue);
+        enc.write_int32(elem.Address);
+        enc.write_float32(elem.MaxValue);
+        enc.write_float32(elem.MinValue);
+#endif
+        write_string<Wide>(enc, elem.Unit);
+        write_string<Wide>(enc, elem.Identifier);
+#if FFIRE_LITTLE_ENDIAN
+        {
+            ParameterFlagBlock blk{static_cast<uint8_t>(elem.CanRamp ? 0x01 : 0x00),
+                                   static_cast<uint8_t>(elem.IsWritable ? 0x01 : 0x00),
+                                   elem.RawFlags};
+            std::memcpy(enc.out + enc.pos, &blk, sizeof(blk));
+            enc.pos += sizeof(blk);
+        }
+#else
+        enc.write_bool(elem.CanRamp);
+        enc.write_bool(elem.IsWritable);
+        enc.write_int64(elem.RawFlags);
+#endif
+        if (elem.IndexedValues.has_value()) {
+            if constexpr (!Packed) enc.write_byte(0x01);
+            write_length<Wide>(enc, elem.IndexedValues.value().size());
+            for (const auto& elem : elem.IndexedValues.value()) {
+                write_string<Wide>(enc, elem);
+            }
+        } else if constexpr (!Packed) {
+            enc.write_byte(0x00);
+        }
+        if (elem.IndexedValuesSource.has_value()) {
+            if constexpr (!Packed) enc.write_byte(0x01);
+            write_string<Wide>(enc, elem.IndexedValuesSource.value());
+        } else if constexpr (!Packed) {
+            enc.write_byte(0x00);
+        }
+    }
+}
+
+} // namespace detail
+
+// Encode Message through an Encoder whose storage is already sized to
+// encoded_size(value). Templated so the std:: and std::pmr:: struct
+// mirrors share one encode walk.
+template <typename PluginVecT>
+inline void encode_plugin_message_to(Encoder& enc, const PluginVecT& value) {
+    {
+        uint16_t len = static_cast<uint16_t>(value.size());
+        enc.write_byte(static_cast<uint8_t>(len));
+        enc.write_byte(static_cast<uint8_t>(len >> 8));
+    }
+    for (const auto& elem : value) {
+        detail::encode_plugin(enc, elem);
+    }
+}
+
+// Encode Message to binary wire format
+inline std::vector<uint8_t> encode_plugin_message(const std::vector<Plugin>& value) {
+    Encoder enc(encoded_size(value));
+    encode_plugin_message_to(enc, value);
+    return std::move(enc.buffer);
+}
+
+// Encode Message into caller-provided storage of at least
+// encoded_size(value) bytes. Returns the number of bytes written.
+inline size_t encode_plugin_message_into(const std::vector<Plugin>& value, uint8_t* out) {
+    Encoder enc(out);
+    encode_plugin_message_to(enc, value);
+    return enc.pos;
+}
+
+inline std::vector<uint8_t> encode_plugin_message(const std::pmr::vector<pmr::Plugin>& value) {
+    Encoder enc(encoded_size(value));
+    encode_plugin_message_to(enc, value);
+    return std::move(enc.buffer);
+}
+
+inline size_t encode_plugin_message_into(const std::pmr::vector<pmr::Plugin>& value, uint8_t* out) {
+    Encoder enc(out);
+    encode_plugin_message_to(enc, value);
+    return enc.pos;
+}
+
+namespace detail {
+
+// Read a parameter's leading presence bitmap in the Packed wire mode,
+// rejecting bits this revision does not define so a marker-format message
+// fed to the packed decoder fails loudly instead of desynchronizing.
+template <typename DecoderT>
+inline uint8_t read_presence_bitmap(DecoderT& dec) {
+    uint8_t present = static_cast<uint8_t>(dec.read_int8());
+    if (present & static_cast<uint8_t>(~(ParameterLayout::IndexedValuesBit |
+                                         ParameterLayout::IndexedValuesSourceBit))) {
+        raise_decode_error("Unknown presence bits in packed message");
+    }
+    return present;
+}
+
+// Decode one top-level Plugin element at the decoder's position; shared by
+// the whole-message and streaming decoders. Wide selects the u32-prefix
+// wire mode, Packed the presence-bitmap optional encoding; lengths are
+// sanity-checked against the remaining bytes before any reserve so a
+// corrupt prefix cannot trigger a huge allocation.
+template <bool Wide = false, bool Packed = false, typename DecoderT = Decoder>
+inline void decode_plugin(DecoderT& dec, Plugin& elem0) {
+    elem0.Name = read_string<Wide>(dec);
+    elem0.ManufacturerID = read_string<Wide>(dec);
+    elem0.Type = read_string<Wide>(dec);
+    elem0.Subtype = read_string<Wide>(dec);
+    {
+        size_t len = read_length<Wide>(dec);
+        dec.check_remaining(
+            len * ((Wide ? ParameterLayoutWide::FixedBytes : ParameterLayout::FixedBytes) -
+                   (Packed ? ParameterLayout::Marker : 0)));
+        elem0.Parameters.reserve(len);
+        for (size_t i = 0; i < len; ++i) {
+            Parameter elem1;
+            bool has_values = false, has_source = false;
+            if constexpr (Packed) {
+                uint8_t present = read_presence_bitmap(dec);
+                has_values = (present & ParameterLayout::IndexedValuesBit) != 0;
+                has_source = (present & ParameterLayout::IndexedValuesSourceBit) != 0;
+            }
+            elem1.DisplayName = read_string<Wide>(dec);
+#if FFIRE_LITTLE_ENDIAN
+            {
+                dec.check_remaining(ParameterLayout::ScalarBlock);
+                ParameterScalarBlock blk;
+                std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                dec.pos += sizeof(blk);
+                elem1.DefaultValue = blk.DefaultValue;
+                elem1.CurrentValue = blk.CurrentValue;
+                elem1.Address = blk.Address;
+                elem1.MaxValue = blk.MaxValue;
+                elem1.MinValue = blk.MinValue;
+            }
+#else
+            elem1.DefaultValue = dec.read_float32();
+            elem1.CurrentValue = dec.read_float32();
+            elem1.Address = dec.read_int32();
+            elem1.MaxValue = dec.read_float32();
+            elem1.MinValue = dec.read_float32();
+#endif
+            elem1.Unit = read_string<Wide>(dec);
+            elem1.Identifier = read_string<Wide>(dec);
+#if FFIRE_LITTLE_ENDIAN
+            {
+                dec.check_remaining(ParameterLayout::FlagBlock);
+                ParameterFlagBlock blk;
+                std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                dec.pos += sizeof(blk);
+                elem1.CanRamp = blk.CanRamp != 0x00;
+                elem1.IsWritable = blk.IsWritable != 0x00;
+                elem1.RawFlags = blk.RawFlags;
+            }
+#else
+            elem1.CanRamp = dec.read_bool();
+            elem1.IsWritable = dec.read_bool();
+            elem1.RawFlags = dec.read_int64();
+#endif
+            if (Packed ? has_values : dec.read_bool()) {
+                std::vector<std::string> tmp;
+                {
+                    size_t len = read_length<Wide>(dec);
+                    dec.check_remaining(len * (Wide ? ParameterLayoutWide::LengthPrefix
+                                                    : ParameterLayout::LengthPrefix));
+                    tmp.reserve(len);
+                    for (size_t i = 0; i < len; ++i) {
+                        std::string elem2;
+                        elem2 = read_string<Wide>(dec);
+                        tmp.push_back(std::move(elem2));
+                    }
+                }
+                elem1.IndexedValues = std::move(tmp);
+            }
+            if (Packed ? has_source : dec.read_bool()) {
+                elem1.IndexedValuesSource = read_string<Wide>(dec);
+            }
+            elem0.Parameters.push_back(std::move(elem1));
+        }
+    }
+}
+
+} // namespace detail
+
+// Decode Message from binary wire format
+inline std::vector<Plugin> decode_plugin_message(const uint8_t* data, size_t size) {
+    Decoder dec(data, size);
+    std::vector<Plugin> result;
+    {
+        uint16_t len = dec.read_array_length();
+        result.reserve(len);
+        for (uint16_t i = 0; i < len; ++i) {
+            Plugin elem0;
+            detail::decode_plugin(dec, elem0);
+            result.push_back(std::move(elem0));
+        }
+    }
+    return result;
+}
+
+inline std::vector<Plugin> decode_plugin_message(const std::vector<uint8_t>& data) {
+    return decode_plugin_message(data.data(), data.size());
+}
+
+namespace detail {
+
+// Arena-aware twin of decode_plugin above; fills an already-constructed
+// pmr::Plugin whose members carry the arena allocator.
+template <bool Wide = false, bool Packed = false, typename DecoderT = Decoder>
+inline void decode_plugin(DecoderT& dec, pmr::Plugin& elem0,
+                          std::pmr::memory_resource* arena) {
+    elem0.Name = read_string_view<Wide>(dec);
+    elem0.ManufacturerID = read_string_view<Wide>(dec);
+    elem0.Type = read_string_view<Wide>(dec);
+    elem0.Subtype = read_string_view<Wide>(dec);
+    {
+        size_t len = read_length<Wide>(dec);
+        dec.check_remaining(
+            len * ((Wide ? ParameterLayoutWide::FixedBytes : ParameterLayout::FixedBytes) -
+                   (Packed ? ParameterLayout::Marker : 0)));
+        elem0.Parameters.reserve(len);
+        for (size_t i = 0; i < len; ++i) {
+            pmr::Parameter& elem1 = elem0.Parameters.emplace_back(arena);
+            bool has_values = false, has_source = false;
+            if constexpr (Packed) {
+                uint8_t present = read_presence_bitmap(dec);
+                has_values = (present & ParameterLayout::IndexedValuesBit) != 0;
+                has_source = (present & ParameterLayout::IndexedValuesSourceBit) != 0;
+            }
+            elem1.DisplayName = read_string_view<Wide>(dec);
+#if FFIRE_LITTLE_ENDIAN
+            {
+                dec.check_remaining(ParameterLayout::ScalarBlock);
+                ParameterScalarBlock blk;
+                std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                dec.pos += sizeof(blk);
+                elem1.DefaultValue = blk.DefaultValue;
+                elem1.CurrentValue = blk.CurrentValue;
+                elem1.Address = blk.Address;
+                elem1.MaxValue = blk.MaxValue;
+                elem1.MinValue = blk.MinValue;
+            }
+#else
+            elem1.DefaultValue = dec.read_float32();
+            elem1.CurrentValue = dec.read_float32();
+            elem1.Address = dec.read_int32();
+            elem1.MaxValue = dec.read_float32();
+            elem1.MinValue = dec.read_float32();
+#endif
+            elem1.Unit = read_string_view<Wide>(dec);
+            elem1.Identifier = read_string_view<Wide>(dec);
+#if FFIRE_LITTLE_ENDIAN
+            {
+                dec.check_remaining(ParameterLayout::FlagBlock);
+                ParameterFlagBlock blk;
+                std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                dec.pos += sizeof(blk);
+                elem1.CanRamp = blk.CanRamp != 0x00;
+                elem1.IsWritable = blk.IsWritable != 0x00;
+                elem1.RawFlags = blk.RawFlags;
+            }
+#else
+            elem1.CanRamp = dec.read_bool();
+            elem1.IsWritable = dec.read_bool();
+            elem1.RawFlags = dec.read_int64();
+#endif
+            if (Packed ? has_values : dec.read_bool()) {
+                std::pmr::vector<std::pmr::string> tmp(arena);
+                {
+                    size_t len = read_length<Wide>(dec);
+                    dec.check_remaining(len * (Wide ? ParameterLayoutWide::LengthPrefix
+                                                    : ParameterLayout::LengthPrefix));
+                    tmp.reserve(len);
+                    for (size_t i = 0; i < len; ++i) {
+                        tmp.emplace_back(read_string_view<Wide>(dec));
+                    }
+                }
+                elem1.IndexedValues = std::move(tmp);
+            }
+            if (Packed ? has_source : dec.read_bool()) {
+                elem1.IndexedValuesSource.emplace(read_string_view<Wide>(dec), arena);
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+// Decode Message into arena-backed pmr containers; strings are copied into
+// the arena so decode performs no individual heap allocations.
+inline std::pmr::vector<pmr::Plugin> decode_plugin_message(
+    const uint8_t* data, size_t size, std::pmr::memory_resource* arena) {
+    Decoder dec(data, size);
+    std::pmr::vector<pmr::Plugin> result(arena);
+    {
+        uint16_t len = dec.read_array_length();
+        result.reserve(len);
+        for (uint16_t i = 0; i < len; ++i) {
+            detail::decode_plugin(dec, result.emplace_back(arena), arena);
+        }
+    }
+    return result;
+}
+
+// Wide-length wire mode
+//
+// Canonical messages carry u16 length prefixes, which caps strings and
+// arrays at 65535 entries and forces oversized catalogs to be split into
+// several messages. The *_wide functions emit and accept the same record
+// layout with u32 prefixes throughout. The two encodings are distinct
+// wire formats — peers must agree on which one a channel carries.
+
+inline size_t encoded_size_wide(const std::vector<Plugin>& value) {
+    return detail::message_encoded_size<true>(value);
+}
+inline size_t encoded_size_wide(const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::message_encoded_size<true>(value);
+}
+
+namespace detail {
+
+template <typename PluginVecT>
+inline std::vector<uint8_t> encode_message_wide(const PluginVecT& value) {
+    Encoder enc(message_encoded_size<true>(value));
+    write_length<true>(enc, value.size());
+    for (const auto& elem : value) {
+        encode_plugin<true>(enc, elem);
+    }
+    return std::move(enc.buffer);
+}
+
+} // namespace detail
+
+// Encode Message to the wide-length wire mode
+inline std::vector<uint8_t> encode_plugin_message_wide(const std::vector<Plugin>& value) {
+    return detail::encode_message_wide(value);
+}
+inline std::vector<uint8_t> encode_plugin_message_wide(
+    const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::encode_message_wide(value);
+}
+
+// Decode Message from the wide-length wire mode
+inline std::vector<Plugin> decode_plugin_message_wide(const uint8_t* data, size_t size) {
+    Decoder dec(data, size);
+    std::vector<Plugin> result;
+    {
+        size_t len = dec.read_length_wide();
+        dec.check_remaining(len * PluginLayoutWide::FixedBytes);
+        result.reserve(len);
+        for (size_t i = 0; i < len; ++i) {
+            Plugin elem0;
+            detail::decode_plugin<true>(dec, elem0);
+            result.push_back(std::move(elem0));
+        }
+    }
+    return result;
+}
+
+inline std::vector<Plugin> decode_plugin_message_wide(const std::vector<uint8_t>& data) {
+    return decode_plugin_message_wide(data.data(), data.size());
+}
+
+inline std::pmr::vector<pmr::Plugin> decode_plugin_message_wide(
+    const uint8_t* data, size_t size, std::pmr::memory_resource* arena) {
+    Decoder dec(data, size);
+    std::pmr::vector<pmr::Plugin> result(arena);
+    {
+        size_t len = dec.read_length_wide();
+        dec.check_remaining(len * PluginLayoutWide::FixedBytes);
+        result.reserve(len);
+        for (size_t i = 0; i < len; ++i) {
+            detail::decode_plugin<true>(dec, result.emplace_back(arena), arena);
+        }
+    }
+    return result;
+}
+
+// Presence-bitmap wire mode
+//
+// Canonical messages spend one marker byte per optional field per record
+// and the decoder pays a data-dependent branch for each. The *_packed
+// functions emit and accept a revision where every parameter record leads
+// with a single bitmap byte covering all its optional fields, so the
+// decoder tests bits held in a register and records without optionals —
+// the overwhelmingly common case — carry no per-field overhead at all.
+// Like the wide mode, this is a distinct wire format: peers must agree on
+// which one a channel carries.
+
+inline size_t encoded_size_packed(const std::vector<Plugin>& value) {
+    return detail::message_encoded_size<false, true>(value);
+}
+inline size_t encoded_size_packed(const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::message_encoded_size<false, true>(value);
+}
+
+namespace detail {
+
+template <typename PluginVecT>
+inline std::vector<uint8_t> encode_message_packed(const PluginVecT& value) {
+    Encoder enc(message_encoded_size<false, true>(value));
+    write_length<false>(enc, value.size());
+    for (const auto& elem : value) {
+        encode_plugin<false, true>(enc, elem);
+    }
+    return std::move(enc.buffer);
+}
+
+} // namespace detail
+
+// Encode Message to the presence-bitmap wire mode
+inline std::vector<uint8_t> encode_plugin_message_packed(const std::vector<Plugin>& value) {
+    return detail::encode_message_packed(value);
+}
+inline std::vector<uint8_t> encode_plugin_message_packed(
+    const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::encode_message_packed(value);
+}
+
+// Decode Message from the presence-bitmap wire mode
+inline std::vector<Plugin> decode_plugin_message_packed(const uint8_t* data, size_t size) {
+    Decoder dec(data, size);
+    std::vector<Plugin> result;
+    {
+        uint16_t len = dec.read_array_length();
+        result.reserve(len);
+        for (uint16_t i = 0; i < len; ++i) {
+            Plugin elem0;
+            detail::decode_plugin<false, true>(dec, elem0);
+            result.push_back(std::move(elem0));
+        }
+    }
+    return result;
+}
+
+inline std::vector<Plugin> decode_plugin_message_packed(const std::vector<uint8_t>& data) {
+    return decode_plugin_message_packed(data.data(), data.size());
+}
+
+inline std::pmr::vector<pmr::Plugin> decode_plugin_message_packed(
+    const uint8_t* data, size_t size, std::pmr::memory_resource* arena) {
+    Decoder dec(data, size);
+    std::pmr::vector<pmr::Plugin> result(arena);
+    {
+        uint16_t len = dec.read_array_length();
+        result.reserve(len);
+        for (uint16_t i = 0; i < len; ++i) {
+            detail::decode_plugin<false, true>(dec, result.emplace_back(arena), arena);
+        }
+    }
+    return result;
+}
+
+// Trusted-input two-phase decode
+//
+// One linear pass over the length structure proves every record lies
+// inside the buffer, then the decode loop runs on UncheckedDecoder with
+// no per-field bounds branches and no exception paths. Worth it for
+// buffers we produced ourselves (same-host IPC); for anything that
+// crossed a trust boundary, stay on decode_plugin_message.
+
+namespace detail {
+
+// Bounds-check one top-level plugin record starting at `pos`; on success
+// `pos` is advanced one past the record. Touches only the length
+// structure — string payloads are skipped, not read.
+inline bool validate_plugin_record(const uint8_t* data, size_t size, size_t& pos) noexcept {
+    auto have = [&](size_t n) { return n <= size - pos; };
+    auto skip_string = [&]() {
+        if (!have(2)) return false;
+        uint16_t len = static_cast<uint16_t>(data[pos]) |
+                       (static_cast<uint16_t>(data[pos + 1]) << 8);
+        pos += 2;
+        if (!have(len)) return false;
+        pos += len;
+        return true;
+    };
+    for (int s = 0; s < 4; ++s) {  // Name..Subtype
+        if (!skip_string()) return false;
+    }
+    if (!have(2)) return false;
+    uint16_t params = static_cast<uint16_t>(data[pos]) |
+                      (static_cast<uint16_t>(data[pos + 1]) << 8);
+    pos += 2;
+    for (uint16_t j = 0; j < params; ++j) {
+        if (!skip_string()) return false;  // DisplayName
+        if (!have(ParameterLayout::ScalarBlock)) return false;
+        pos += ParameterLayout::ScalarBlock;
+        if (!skip_string()) return false;  // Unit
+        if (!skip_string()) return false;  // Identifier
+        if (!have(ParameterLayout::FlagBlock)) return false;
+        pos += ParameterLayout::FlagBlock;
+        if (!have(1)) return false;
+        if (data[pos++] != 0x00) {
+            if (!have(2)) return false;
+            uint16_t len = static_cast<uint16_t>(data[pos]) |
+                           (static_cast<uint16_t>(data[pos + 1]) << 8);
+            pos += 2;
+            for (uint16_t k = 0; k < len; ++k) {
+                if (!skip_string()) return false;
+            }
+        }
+        if (!have(1)) return false;
+        if (data[pos++] != 0x00) {
+            if (!skip_string()) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// Returns true when every length prefix and fixed-width block of the
+// message lies within `size` bytes.
+inline bool validate_plugin_message(const uint8_t* data, size_t size) noexcept {
+    size_t pos = 0;
+    if (size < 2) return false;
+    uint16_t count = static_cast<uint16_t>(data[pos]) |
+                     (static_cast<uint16_t>(data[pos + 1]) << 8);
+    pos += 2;
+    for (uint16_t i = 0; i < count; ++i) {
+        if (!detail::validate_plugin_record(data, size, pos)) return false;
+    }
+    return true;
+}
+
+inline bool validate_plugin_message(const std::vector<uint8_t>& data) noexcept {
+    return validate_plugin_message(data.data(), data.size());
+}
+
+// Decode Message from a buffer we produced ourselves: validate once, then
+// decode without per-field checks. Throws std::runtime_error only when
+// validation rejects the buffer.
+inline std::vector<Plugin> decode_plugin_message_trusted(const uint8_t* data, size_t size) {
+    if (!validate_plugin_message(data, size)) {
+        detail::raise_decode_error("message failed validation for trusted decode");
+    }
+    UncheckedDecoder dec(data, size);
+    std::vector<Plugin> result;
+    {
+        uint16_t len = dec.read_array_length();
+        result.reserve(len);
+        for (uint16_t i = 0; i < len; ++i) {
+            Plugin elem0;
+            detail::decode_plugin(dec, elem0);
+            result.push_back(std::move(elem0));
+        }
+    }
+    return result;
+}
+
+inline std::vector<Plugin> decode_plugin_message_trusted(const std::vector<uint8_t>& data) {
+    return decode_plugin_message_trusted(data.data(), data.size());
+}
+
+inline std::pmr::vector<pmr::Plugin> decode_plugin_message_trusted(
+    const uint8_t* data, size_t size, std::pmr::memory_resource* arena) {
+    if (!validate_plugin_message(data, size)) {
+        detail::raise_decode_error("message failed validation for trusted decode");
+    }
+    UncheckedDecoder dec(data, size);
+    std::pmr::vector<pmr::Plugin> result(arena);
+    {
+        uint16_t len = dec.read_array_length();
+        result.reserve(len);
+        for (uint16_t i = 0; i < len; ++i) {
+            detail::decode_plugin(dec, result.emplace_back(arena), arena);
+        }
+    }
+    return result;
+}
+
+// Exception-free decode API
+//
+// The same validate-then-unchecked pipeline as the trusted decoder, but
+// malformed input is reported through a status code instead of a throw,
+// so the functions link cleanly in -fno-exceptions builds and keep
+// unwind machinery out of the hot path everywhere else.
+enum class DecodeStatus {
+    Ok = 0,
+    Malformed,  // validation rejected the buffer
+};
+
+inline DecodeStatus decode_plugin_message_nothrow(const uint8_t* data, size_t size,
+                                                  std::vector<Plugin>& out) noexcept {
+    if (!validate_plugin_message(data, size)) {
+        return DecodeStatus::Malformed;
+    }
+    UncheckedDecoder dec(data, size);
+    out.clear();
+    uint16_t len = dec.read_array_length();
+    out.reserve(len);
+    for (uint16_t i = 0; i < len; ++i) {
+        Plugin elem0;
+        detail::decode_plugin(dec, elem0);
+        out.push_back(std::move(elem0));
+    }
+    return DecodeStatus::Ok;
+}
+
+inline DecodeStatus decode_plugin_message_nothrow(const std::vector<uint8_t>& data,
+                                                  std::vector<Plugin>& out) noexcept {
+    return decode_plugin_message_nothrow(data.data(), data.size(), out);
+}
+
+inline DecodeStatus decode_plugin_message_nothrow(
+    const uint8_t* data, size_t size, std::pmr::vector<pmr::Plugin>& out,
+    std::pmr::memory_resource* arena) noexcept {
+    if (!validate_plugin_message(data, size)) {
+        return DecodeStatus::Malformed;
+    }
+    UncheckedDecoder dec(data, size);
+    out.clear();
+    uint16_t len = dec.read_array_length();
+    out.reserve(len);
+    for (uint16_t i = 0; i < len; ++i) {
+        detail::decode_plugin(dec, out.emplace_back(arena), arena);
+    }
+    return DecodeStatus::Ok;
+}
+
+// String-interning decode mode
+//
+// Real catalogs repeat a small vocabulary across tens of thousands of
+// records — Unit is almost always one of "dB", "Hz", "ms", "%", and
+// identifier prefixes recur heavily. StringPool stores each distinct
+// value once; the interned decode returns records whose text fields are
+// string_views into the pool, so repeated values cost one allocation per
+// distinct string instead of one per record, and equality between
+// interned fields short-circuits on the data pointer. The pool must
+// outlive every record decoded against it, and one pool can be shared
+// across decodes to dedupe whole fleets of catalogs.
+
+class StringPool {
+public:
+    // Return a stable view of `s`, storing the bytes on first sight.
+    std::string_view intern(std::string_view s) {
+        auto it = index_.find(s);
+        if (it != index_.end()) {
+            return *it;
+        }
+        storage_.emplace_back(s);
+        std::string_view stored(storage_.back());
+        index_.insert(stored);
+        bytes_ += s.size();
+        return stored;
+    }
+
+    size_t size() const { return storage_.size(); }  // distinct strings
+    size_t bytes() const { return bytes_; }          // payload bytes held
+
+private:
+    std::deque<std::string> storage_;        // deque: stored strings never move
+    std::unordered_set<std::string_view> index_;  // views into storage_
+    size_t bytes_ = 0;
+};
+
+// Pool-backed mirrors of Parameter and Plugin: every text field is a
+// string_view into the StringPool the message was decoded with.
+namespace interned {
+
+struct Parameter {
+    std::string_view DisplayName;
+    float DefaultValue = 0.0f;
+    float CurrentValue = 0.0f;
+    int32_t Address = 0;
+    float MaxValue = 0.0f;
+    float MinValue = 0.0f;
+    std::string_view Unit;
+    std::string_view Identifier;
+    bool CanRamp = false;
+    bool IsWritable = false;
+    int64_t RawFlags = 0;
+    std::optional<std::vector<std::string_view>> IndexedValues;
+    std::optional<std::string_view> IndexedValuesSource;
+};
+
+struct Plugin {
+    std::string_view Name;
+    std::string_view ManufacturerID;
+    std::string_view Type;
+    std::string_view Subtype;
+    std::vector<Parameter> Parameters;
+};
+
+} // namespace interned
+
+inline size_t encoded_size(const interned::Parameter& value) {
+    return detail::parameter_encoded_size(value);
+}
+inline size_t encoded_size(const interned::Plugin& value) {
+    return detail::plugin_encoded_size(value);
+}
+inline size_t encoded_size(const std::vector<interned::Plugin>& value) {
+    return detail::message_encoded_size(value);
+}
+
+// Interned records re-encode through the shared walk like the other
+// families.
+inline std::vector<uint8_t> encode_plugin_message(const std::vector<interned::Plugin>& value) {
+    Encoder enc(encoded_size(value));
+    encode_plugin_message_to(enc, value);
+    return std::move(enc.buffer);
+}
+
+// Decode Message, interning every text field through `pool`.
+inline std::vector<interned::Plugin> decode_plugin_message_interned(
+    const uint8_t* data, size_t size, StringPool& pool) {
+    Decoder dec(data, size);
+    std::vector<interned::Plugin> result;
+    uint16_t count = dec.read_array_length();
+    result.reserve(count);
+    for (uint16_t i = 0; i < count; ++i) {
+        interned::Plugin& elem0 = result.emplace_back();
+        elem0.Name = pool.intern(dec.read_string_view());
+        elem0.ManufacturerID = pool.intern(dec.read_string_view());
+        elem0.Type = pool.intern(dec.read_string_view());
+        elem0.Subtype = pool.intern(dec.read_string_view());
+        {
+            size_t len = dec.read_array_length();
+            dec.check_remaining(len * ParameterLayout::FixedBytes);
+            elem0.Parameters.reserve(len);
+            for (size_t j = 0; j < len; ++j) {
+                interned::Parameter& elem1 = elem0.Parameters.emplace_back();
+                elem1.DisplayName = pool.intern(dec.read_string_view());
+#if FFIRE_LITTLE_ENDIAN
+                {
+                    dec.check_remaining(ParameterLayout::ScalarBlock);
+                    ParameterScalarBlock blk;
+                    std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                    dec.pos += sizeof(blk);
+                    elem1.DefaultValue = blk.DefaultValue;
+                    elem1.CurrentValue = blk.CurrentValue;
+                    elem1.Address = blk.Address;
+                    elem1.MaxValue = blk.MaxValue;
+                    elem1.MinValue = blk.MinValue;
+                }
+#else
+                elem1.DefaultValue = dec.read_float32();
+                elem1.CurrentValue = dec.read_float32();
+                elem1.Address = dec.read_int32();
+                elem1.MaxValue = dec.read_float32();
+                elem1.MinValue = dec.read_float32();
+#endif
+                elem1.Unit = pool.intern(dec.read_string_view());
+                elem1.Identifier = pool.intern(dec.read_string_view());
+#if FFIRE_LITTLE_ENDIAN
+                {
+                    dec.check_remaining(ParameterLayout::FlagBlock);
+                    ParameterFlagBlock blk;
+                    std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                    dec.pos += sizeof(blk);
+                    elem1.CanRamp = blk.CanRamp != 0x00;
+                    elem1.IsWritable = blk.IsWritable != 0x00;
+                    elem1.RawFlags = blk.RawFlags;
+                }
+#else
+                elem1.CanRamp = dec.read_bool();
+                elem1.IsWritable = dec.read_bool();
+                elem1.RawFlags = dec.read_int64();
+#endif
+                if (dec.read_bool()) {
+                    std::vector<std::string_view> tmp;
+                    {
+                        size_t len2 = dec.read_array_length();
+                        dec.check_remaining(len2 * ParameterLayout::LengthPrefix);
+                        tmp.reserve(len2);
+                        for (size_t k = 0; k < len2; ++k) {
+                            tmp.push_back(pool.intern(dec.read_string_view()));
+                        }
+                    }
+                    elem1.IndexedValues = std::move(tmp);
+                }
+                if (dec.read_bool()) {
+                    elem1.IndexedValuesSource = pool.intern(dec.read_string_view());
+                }
+            }
+        }
+    }
+    return result;
+}
+
+inline std::vector<interned::Plugin> decode_plugin_message_interned(
+    const std::vector<uint8_t>& data, StringPool& pool) {
+    return decode_plugin_message_interned(data.data(), data.size(), pool);
+}
+
+// Scatter-gather encode for zero-copy network sends
+//
+// Instead of flattening the message, produce an ordered segment list:
+// fixed-width runs and length prefixes are packed into a small header
+// arena, while string payloads are borrowed straight from the message's
+// own storage. Handing the list to writev() sends a multi-megabyte
+// catalog without ever copying its strings. The source message must stay
+// alive and unmodified until the segments have been written.
+struct EncodedSegment {
+    const uint8_t* data;
+    size_t len;
+};
+
+struct SegmentedMessage {
+    std::vector<EncodedSegment> segments;
+    std::vector<uint8_t> header_arena;  // backing store for non-payload segments
+    size_t total = 0;                   // sum of all segment lengths
+};
+
+namespace detail {
+
+template <typename PluginVecT>
+inline SegmentedMessage build_message_segments(const PluginVecT& value) {
+    SegmentedMessage msg;
+    msg.total = message_encoded_size(value);
+
+    // Everything that is not a string payload lands in the header arena;
+    // size it exactly so the segments can borrow stable pointers into it.
+    size_t payload = 0;
+    for (const auto& elem : value) {
+        payload += elem.Name.size() + elem.ManufacturerID.size() +
+                   elem.Type.size() + elem.Subtype.size();
+        for (const auto& param : elem.Parameters) {
+            payload += param.DisplayName.size() + param.Unit.size() +
+                       param.Identifier.size();
+            if (param.IndexedValues.has_value()) {
+                for (const auto& s : param.IndexedValues.value()) {
+                    payload += s.size();
+                }
+            }
+            if (param.IndexedValuesSource.has_value()) {
+                payload += param.IndexedValuesSource.value().size();
+            }
+        }
+    }
+    msg.header_arena.resize(msg.total - payload);
+
+    Encoder enc(msg.header_arena.data());
+    size_t seg_start = 0;
+    auto flush_header = [&]() {
+        if (enc.pos > seg_start) {
+            msg.segments.push_back({msg.header_arena.data() + seg_start,
+                                    enc.pos - seg_start});
+            seg_start = enc.pos;
+        }
+    };
+    // Length prefix into the header run, payload borrowed from the string.
+    auto emit_string = [&](std::string_view s) {
+        uint16_t len = static_cast<uint16_t>(s.size());
+        enc.write_byte(static_cast<uint8_t>(len));
+        enc.write_byte(static_cast<uint8_t>(len >> 8));
+        if (!s.empty()) {
+            flush_header();
+            msg.segments.push_back(
+                {reinterpret_cast<const uint8_t*>(s.data()), s.size()});
+        }
+    };
+
+    {
+        uint16_t len = static_cast<uint16_t>(value.size());
+        enc.write_byte(static_cast<uint8_t>(len));
+        enc.write_byte(static_cast<uint8_t>(len >> 8));
+    }
+    for (const auto& elem : value) {
+        emit_string(elem.Name);
+        emit_string(elem.ManufacturerID);
+        emit_string(elem.Type);
+        emit_string(elem.Subtype);
+        {
+            uint16_t len = static_cast<uint16_t>(elem.Parameters.size());
+            enc.write_byte(static_cast<uint8_t>(len));
+            enc.write_byte(static_cast<uint8_t>(len >> 8));
+        }
+        for (const auto& param : elem.Parameters) {
+            emit_string(param.DisplayName);
+            enc.write_float32(param.DefaultValue);
+            enc.write_float32(param.CurrentValue);
+            enc.write_int32(param.Address);
+            enc.write_float32(param.MaxValue);
+            enc.write_float32(param.MinValue);
+            emit_string(param.Unit);
+            emit_string(param.Identifier);
+            enc.write_bool(param.CanRamp);
+            enc.write_bool(param.IsWritable);
+            enc.write_int64(param.RawFlags);
+            if (param.IndexedValues.has_value()) {
+                enc.write_byte(0x01);
+                {
+                    uint16_t len = static_cast<uint16_t>(param.IndexedValues.value().size());
+                    enc.write_byte(static_cast<uint8_t>(len));
+                    enc.write_byte(static_cast<uint8_t>(len >> 8));
+                }
+                for (const auto& s : param.IndexedValues.value()) {
+                    emit_string(s);
+                }
+            } else {
+                enc.write_byte(0x00);
+            }
+            if (param.IndexedValuesSource.has_value()) {
+                enc.write_byte(0x01);
+                emit_string(param.IndexedValuesSource.value());
+            } else {
+                enc.write_byte(0x00);
+            }
+        }
+    }
+    flush_header();
+    return msg;
+}
+
+} // namespace detail
+
+inline SegmentedMessage encode_plugin_message_segments(const std::vector<Plugin>& value) {
+    return detail::build_message_segments(value);
+}
+
+inline SegmentedMessage encode_plugin_message_segments(const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::build_message_segments(value);
+}
+
+// Incremental decoder for chunked transports (sockets, pipes)
+//
+// Feed bytes as they arrive and drain completed top-level Plugin elements
+// with next(); decode overlaps network I/O and peak memory is capped at
+// the unconsumed tail plus one element instead of the whole message.
+//
+//   StreamingPluginDecoder sd;
+//   while (read(fd, chunk)) {
+//       sd.feed(chunk.data(), chunk.size());
+//       Plugin plugin;
+//       while (sd.next(plugin)) { handle(plugin); }
+//   }
+class StreamingPluginDecoder {
+public:
+    // Append a chunk of wire bytes to the pending buffer.
+    void feed(const uint8_t* chunk, size_t len) {
+        buffer_.insert(buffer_.end(), chunk, chunk + len);
+    }
+
+    // Decode the next complete Plugin into `out`. Returns false when no
+    // complete element is pending yet (feed more bytes) or the message is
+    // done; `out` is only valid after a true return.
+    bool next(Plugin& out) {
+        if (!header_parsed_) {
+            if (buffer_.size() < 2) {
+                return false;
+            }
+            Decoder dec(buffer_.data(), buffer_.size());
+            expected_ = dec.read_array_length();
+            buffer_.erase(buffer_.begin(), buffer_.begin() + 2);
+            header_parsed_ = true;
+        }
+        if (decoded_ == expected_) {
+            return false;
+        }
+        size_t end = 0;
+        if (!detail::validate_plugin_record(buffer_.data(), buffer_.size(), end)) {
+            // Element still incomplete; suspended until the next feed.
+            return false;
+        }
+        UncheckedDecoder dec(buffer_.data(), end);
+        out.Parameters.clear();
+        detail::decode_plugin(dec, out);
+        buffer_.erase(buffer_.begin(), buffer_.begin() + dec.pos);
+        ++decoded_;
+        return true;
+    }
+
+    // True once every element of the message has been handed out.
+    bool done() const { return header_parsed_ && decoded_ == expected_; }
+
+    // Top-level element count from the message header; 0 until the header
+    // has been fed.
+    uint16_t expected_count() const { return expected_; }
+    uint16_t decoded_count() const { return decoded_; }
+
+private:
+    std::vector<uint8_t> buffer_;  // unconsumed wire bytes
+    bool header_parsed_ = false;
+    uint16_t expected_ = 0;
+    uint16_t decoded_ = 0;
+};
+
+// Framed wire variant for multi-core decode
+//
+// The canonical format is strictly sequential: a plugin's extent is only
+// known after decoding it. The framed variant writes a u32 byte length
+// before each top-level element, so a decoder can partition the buffer up
+// front and decode elements across a thread pool, merging into the result
+// vector by index. Element payloads stay byte-identical to the flat
+// encoding — only the framing differs — but the two encodings are not
+// interchangeable on the wire.
+
+inline size_t encoded_size_framed(const std::vector<Plugin>& value) {
+    return detail::message_encoded_size(value) + 4 * value.size();
+}
+inline size_t encoded_size_framed(const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::message_encoded_size(value) + 4 * value.size();
+}
+
+namespace detail {
+
+template <typename PluginVecT>
+inline std::vector<uint8_t> encode_message_framed(const PluginVecT& value) {
+    Encoder enc(message_encoded_size(value) + 4 * value.size());
+    {
+        uint16_t len = static_cast<uint16_t>(value.size());
+        enc.write_byte(static_cast<uint8_t>(len));
+        enc.write_byte(static_cast<uint8_t>(len >> 8));
+    }
+    for (const auto& elem : value) {
+        enc.write_int32(static_cast<int32_t>(plugin_encoded_size(elem)));
+        encode_plugin(enc, elem);
+    }
+    return std::move(enc.buffer);
+}
+
+} // namespace detail
+
+// Encode Message to the framed wire variant
+inline std::vector<uint8_t> encode_plugin_message_framed(const std::vector<Plugin>& value) {
+    return detail::encode_message_framed(value);
+}
+inline std::vector<uint8_t> encode_plugin_message_framed(
+    const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::encode_message_framed(value);
+}
+
+// Decode a framed Message, spreading top-level elements over `threads`
+// workers (0 picks std::thread::hardware_concurrency()). Each worker
+// decodes an index-contiguous slice straight into the pre-sized result, so
+// element order matches the sequential decoder; a malformed element is
+// reported once the workers have joined.
+inline std::vector<Plugin> decode_plugin_message_framed(const uint8_t* data, size_t size,
+                                                        unsigned threads = 0) {
+    Decoder dec(data, size);
+    uint16_t count = dec.read_array_length();
+
+    // Partition pass: one u32 read per element, no payload decoding.
+    std::vector<size_t> offsets(count);
+    std::vector<size_t> lengths(count);
+    for (uint16_t i = 0; i < count; ++i) {
+        uint32_t elem_len = static_cast<uint32_t>(dec.read_int32());
+        dec.check_remaining(elem_len);
+        offsets[i] = dec.pos;
+        lengths[i] = elem_len;
+        dec.pos += elem_len;
+    }
+
+    std::vector<Plugin> result(count);
+    if (count == 0) {
+        return result;
+    }
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+    }
+    if (threads > count) {
+        threads = count;
+    }
+    if (threads == 1) {
+        for (uint16_t i = 0; i < count; ++i) {
+            size_t extent = 0;
+            if (!detail::validate_plugin_record(data + offsets[i], lengths[i], extent)) {
+                detail::raise_decode_error("malformed element in framed message");
+            }
+            UncheckedDecoder elem_dec(data + offsets[i], lengths[i]);
+            detail::decode_plugin(elem_dec, result[i]);
+        }
+        return result;
+    }
+
+    std::vector<std::thread> pool;
+    std::vector<uint8_t> failed(threads, 0);
+    pool.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            size_t begin = static_cast<size_t>(count) * t / threads;
+            size_t end = static_cast<size_t>(count) * (t + 1) / threads;
+            for (size_t i = begin; i < end; ++i) {
+                // Each element is validated and decoded from its own
+                // slice, so a bad length cannot bleed into a neighbour.
+                size_t extent = 0;
+                if (!detail::validate_plugin_record(data + offsets[i], lengths[i], extent)) {
+                    failed[t] = 1;
+                    return;
+                }
+                UncheckedDecoder elem_dec(data + offsets[i], lengths[i]);
+                detail::decode_plugin(elem_dec, result[i]);
+            }
+        });
+    }
+    for (auto& worker : pool) {
+        worker.join();
+    }
+    for (uint8_t f : failed) {
+        if (f) {
+            detail::raise_decode_error("malformed element in framed message");
+        }
+    }
+    return result;
+}
+
+inline std::vector<Plugin> decode_plugin_message_framed(const std::vector<uint8_t>& data,
+                                                        unsigned threads = 0) {
+    return decode_plugin_message_framed(data.data(), data.size(), threads);
+}
+
+// Columnar (struct-of-arrays) decode target
+//
+// ParameterColumns lays every parameter of every plugin out as one
+// contiguous array per field, so scans over the numeric columns stride
+// over 4-8 bytes per record instead of a whole Parameter with its strings
+// and optionals. Text fields live in one shared string table referenced
+// by offset/length; a numeric scan never touches it.
+
+// Offset/length reference into ParameterColumns::Strings.
+struct ColumnStringRef {
+    uint32_t Offset;
+    uint32_t Length;
+};
+
+struct ParameterColumns {
+    // One entry per plugin.
+    std::vector<ColumnStringRef> PluginName;
+    std::vector<ColumnStringRef> PluginManufacturerID;
+    std::vector<ColumnStringRef> PluginType;
+    std::vector<ColumnStringRef> PluginSubtype;
+    std::vector<uint32_t> ParametersFirst;  // index into the parameter columns
+    std::vector<uint32_t> ParametersCount;
+
+    // One entry per parameter, in message order across all plugins.
+    std::vector<float> DefaultValue;
+    std::vector<float> CurrentValue;
+    std::vector<int32_t> Address;
+    std::vector<float> MaxValue;
+    std::vector<float> MinValue;
+    std::vector<int64_t> RawFlags;
+    std::vector<uint8_t> CanRamp;
+    std::vector<uint8_t> IsWritable;
+    std::vector<ColumnStringRef> DisplayName;
+    std::vector<ColumnStringRef> Unit;
+    std::vector<ColumnStringRef> Identifier;
+
+    // Optional fields; Has* entries gate the corresponding references.
+    std::vector<uint8_t> HasIndexedValues;
+    std::vector<uint32_t> IndexedValuesFirst;  // index into IndexedValuePool
+    std::vector<uint32_t> IndexedValuesCount;
+    std::vector<uint8_t> HasIndexedValuesSource;
+    std::vector<ColumnStringRef> IndexedValuesSource;
+    std::vector<ColumnStringRef> IndexedValuePool;
+
+    // Shared string table for every text field above.
+    std::string Strings;
+
+    size_t plugin_count() const { return PluginName.size(); }
+    size_t parameter_count() const { return CurrentValue.size(); }
+
+    std::string_view str(ColumnStringRef ref) const {
+        return std::string_view(Strings.data() + ref.Offset, ref.Length);
+    }
+};
+
+namespace detail {
+
+template <typename ColumnsT>
+inline ColumnStringRef intern_column_string(ColumnsT& cols, std::string_view s) {
+    ColumnStringRef ref;
+    ref.Offset = static_cast<uint32_t>(cols.Strings.size());
+    ref.Length = static_cast<uint32_t>(s.size());
+    cols.Strings.append(s.data(), s.size());
+    return ref;
+}
+
+} // namespace detail
+
+// Decode Message straight into columns; no per-record structs are
+// materialized on the way.
+inline ParameterColumns decode_plugin_message_columnar(const uint8_t* data, size_t size) {
+    Decoder dec(data, size);
+    ParameterColumns cols;
+    uint16_t count = dec.read_array_length();
+    cols.PluginName.reserve(count);
+    cols.PluginManufacturerID.reserve(count);
+    cols.PluginType.reserve(count);
+    cols.PluginSubtype.reserve(count);
+    cols.ParametersFirst.reserve(count);
+    cols.ParametersCount.reserve(count);
+    for (uint16_t i = 0; i < count; ++i) {
+        cols.PluginName.push_back(detail::intern_column_string(cols, dec.read_string_view()));
+        cols.PluginManufacturerID.push_back(
+            detail::intern_column_string(cols, dec.read_string_view()));
+        cols.PluginType.push_back(detail::intern_column_string(cols, dec.read_string_view()));
+        cols.PluginSubtype.push_back(detail::intern_column_string(cols, dec.read_string_view()));
+        uint16_t params = dec.read_array_length();
+        cols.ParametersFirst.push_back(static_cast<uint32_t>(cols.parameter_count()));
+        cols.ParametersCount.push_back(params);
+        for (uint16_t j = 0; j < params; ++j) {
+            cols.DisplayName.push_back(
+                detail::intern_column_string(cols, dec.read_string_view()));
+#if FFIRE_LITTLE_ENDIAN
+            {
+                dec.check_remaining(ParameterLayout::ScalarBlock);
+                ParameterScalarBlock blk;
+                std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                dec.pos += sizeof(blk);
+                cols.DefaultValue.push_back(blk.DefaultValue);
+                cols.CurrentValue.push_back(blk.CurrentValue);
+                cols.Address.push_back(blk.Address);
+                cols.MaxValue.push_back(blk.MaxValue);
+                cols.MinValue.push_back(blk.MinValue);
+            }
+#else
+            cols.DefaultValue.push_back(dec.read_float32());
+            cols.CurrentValue.push_back(dec.read_float32());
+            cols.Address.push_back(dec.read_int32());
+            cols.MaxValue.push_back(dec.read_float32());
+            cols.MinValue.push_back(dec.read_float32());
+#endif
+            cols.Unit.push_back(detail::intern_column_string(cols, dec.read_string_view()));
+            cols.Identifier.push_back(
+                detail::intern_column_string(cols, dec.read_string_view()));
+#if FFIRE_LITTLE_ENDIAN
+            {
+                dec.check_remaining(ParameterLayout::FlagBlock);
+                ParameterFlagBlock blk;
+                std::memcpy(&blk, dec.data + dec.pos, sizeof(blk));
+                dec.pos += sizeof(blk);
+                cols.CanRamp.push_back(blk.CanRamp != 0x00 ? 0x01 : 0x00);
+                cols.IsWritable.push_back(blk.IsWritable != 0x00 ? 0x01 : 0x00);
+                cols.RawFlags.push_back(blk.RawFlags);
+            }
+#else
+            cols.CanRamp.push_back(dec.read_bool() ? 0x01 : 0x00);
+            cols.IsWritable.push_back(dec.read_bool() ? 0x01 : 0x00);
+            cols.RawFlags.push_back(dec.read_int64());
+#endif
+            if (dec.read_bool()) {
+                cols.HasIndexedValues.push_back(0x01);
+                uint16_t len = dec.read_array_length();
+                cols.IndexedValuesFirst.push_back(
+                    static_cast<uint32_t>(cols.IndexedValuePool.size()));
+                cols.IndexedValuesCount.push_back(len);
+                for (uint16_t k = 0; k < len; ++k) {
+                    cols.IndexedValuePool.push_back(
+                        detail::intern_column_string(cols, dec.read_string_view()));
+                }
+            } else {
+                cols.HasIndexedValues.push_back(0x00);
+                cols.IndexedValuesFirst.push_back(0);
+                cols.IndexedValuesCount.push_back(0);
+            }
+            if (dec.read_bool()) {
+                cols.HasIndexedValuesSource.push_back(0x01);
+                cols.IndexedValuesSource.push_back(
+                    detail::intern_column_string(cols, dec.read_string_view()));
+            } else {
+                cols.HasIndexedValuesSource.push_back(0x00);
+                cols.IndexedValuesSource.push_back(ColumnStringRef{0, 0});
+            }
+        }
+    }
+    return cols;
+}
+
+inline ParameterColumns decode_plugin_message_columnar(const std::vector<uint8_t>& data) {
+    return decode_plugin_message_columnar(data.data(), data.size());
+}
+
+namespace detail {
+
+// Columnar projection of an already-decoded message; used by the C bridge
+// where the handle holds materialized records rather than wire bytes.
+template <typename PluginVecT>
+inline ParameterColumns build_columns(const PluginVecT& value) {
+    ParameterColumns cols;
+    cols.PluginName.reserve(value.size());
+    cols.ParametersFirst.reserve(value.size());
+    cols.ParametersCount.reserve(value.size());
+    for (const auto& elem : value) {
+        cols.PluginName.push_back(intern_column_string(cols, elem.Name));
+        cols.PluginManufacturerID.push_back(intern_column_string(cols, elem.ManufacturerID));
+        cols.PluginType.push_back(intern_column_string(cols, elem.Type));
+        cols.PluginSubtype.push_back(intern_column_string(cols, elem.Subtype));
+        cols.ParametersFirst.push_back(static_cast<uint32_t>(cols.parameter_count()));
+        cols.ParametersCount.push_back(static_cast<uint32_t>(elem.Parameters.size()));
+        for (const auto& param : elem.Parameters) {
+            cols.DisplayName.push_back(intern_column_string(cols, param.DisplayName));
+            cols.DefaultValue.push_back(param.DefaultValue);
+            cols.CurrentValue.push_back(param.CurrentValue);
+            cols.Address.push_back(param.Address);
+            cols.MaxValue.push_back(param.MaxValue);
+            cols.MinValue.push_back(param.MinValue);
+            cols.Unit.push_back(intern_column_string(cols, param.Unit));
+            cols.Identifier.push_back(intern_column_string(cols, param.Identifier));
+            cols.CanRamp.push_back(param.CanRamp ? 0x01 : 0x00);
+            cols.IsWritable.push_back(param.IsWritable ? 0x01 : 0x00);
+            cols.RawFlags.push_back(param.RawFlags);
+            if (param.IndexedValues.has_value()) {
+                cols.HasIndexedValues.push_back(0x01);
+                cols.IndexedValuesFirst.push_back(
+                    static_cast<uint32_t>(cols.IndexedValuePool.size()));
+                cols.IndexedValuesCount.push_back(
+                    static_cast<uint32_t>(param.IndexedValues->size()));
+                for (const auto& iv : param.IndexedValues.value()) {
+                    cols.IndexedValuePool.push_back(intern_column_string(cols, iv));
+                }
+            } else {
+                cols.HasIndexedValues.push_back(0x00);
+                cols.IndexedValuesFirst.push_back(0);
+                cols.IndexedValuesCount.push_back(0);
+            }
+            if (param.IndexedValuesSource.has_value()) {
+                cols.HasIndexedValuesSource.push_back(0x01);
+                cols.IndexedValuesSource.push_back(
+                    intern_column_string(cols, param.IndexedValuesSource.value()));
+            } else {
+                cols.HasIndexedValuesSource.push_back(0x00);
+                cols.IndexedValuesSource.push_back(ColumnStringRef{0, 0});
+            }
+        }
+    }
+    return cols;
+}
+
+} // namespace detail
+
+// Zero-copy decode views over the wire format
+//
+// The *View types read fields directly out of the caller's wire buffer:
+// strings come back as std::string_view into the buffer and scalars are
+// loaded on demand, so inspecting a message performs no heap allocations.
+// The buffer handed to PluginMessageView must outlive every view derived
+// from it. Record extents are validated while positioning a view, so a
+// truncated buffer throws std::runtime_error just like the eager decoder.
+
+class ParameterView {
+public:
+    ParameterView() = default;
+
+    std::string_view DisplayName() const { return string_at(begin_, fixed_a_); }
+    float DefaultValue() const { return float_at(fixed_a_); }
+    float CurrentValue() const { return float_at(fixed_a_ + 4); }
+    int32_t Address() const { return static_cast<int32_t>(load_u32(fixed_a_ + 8)); }
+    float MaxValue() const { return float_at(fixed_a_ + 12); }
+    float MinValue() const { return float_at(fixed_a_ + 16); }
+    std::string_view Unit() const { return string_at(unit_, ident_); }
+    std::string_view Identifier() const { return string_at(ident_, fixed_b_); }
+    bool CanRamp() const { return data_[fixed_b_] != 0x00; }
+    bool IsWritable() const { return data_[fixed_b_ + 1] != 0x00; }
+    int64_t RawFlags() const { return static_cast<int64_t>(load_u64(fixed_b_ + 2)); }
+
+    bool HasIndexedValues() const { return data_[opt_] != 0x00; }
+
+    uint16_t IndexedValuesCount() const {
+        if (!HasIndexedValues()) return 0;
+        return static_cast<uint16_t>(data_[opt_ + 1]) |
+               (static_cast<uint16_t>(data_[opt_ + 2]) << 8);
+    }
+
+    // Entries are length-prefixed, so random access is O(index); iterate
+    // sequentially when scanning all values.
+    std::string_view IndexedValue(size_t index) const {
+        size_t p = opt_ + 3;
+        for (size_t i = 0; i < index; ++i) {
+            p += 2 + string_len_at(p);
+        }
+        uint16_t len = string_len_at(p);
+        return std::string_view(reinterpret_cast<const char*>(data_ + p + 2), len);
+    }
+
+    bool HasIndexedValuesSource() const { return data_[src_] != 0x00; }
+
+    std::string_view IndexedValuesSource() const {
+        uint16_t len = string_len_at(src_ + 1);
+        return std::string_view(reinterpret_cast<const char*>(data_ + src_ + 3), len);
+    }
+
+private:
+    friend class PluginView;
+
+    // Positions the view on the record starting at `offset`, validating its
+    // extent. Returns the offset one past the record.
+    size_t position(const uint8_t* data, size_t size, size_t offset) {
+        Decoder dec(data, size);
+        dec.pos = offset;
+        data_ = data;
+        begin_ = offset;
+        dec.read_string_view();                       // DisplayName
+        fixed_a_ = dec.pos;
+        dec.check_remaining(20);                      // DefaultValue..MinValue
+        dec.pos += 20;
+        unit_ = dec.pos;
+        dec.read_string_view();                       // Unit
+        ident_ = dec.pos;
+        dec.read_string_view();                       // Identifier
+        fixed_b_ = dec.pos;
+        dec.check_remaining(10);                      // CanRamp..RawFlags
+        dec.pos += 10;
+        opt_ = dec.pos;
+        if (dec.read_bool()) {                        // IndexedValues
+            uint16_t len = dec.read_array_length();
+            for (uint16_t i = 0; i < len; ++i) {
+                dec.read_string_view();
+            }
+        }
+        src_ = dec.pos;
+        if (dec.read_bool()) {                        // IndexedValuesSource
+            dec.read_string_view();
+        }
+        return dec.pos;
+    }
+
+    // Unchecked loads: position() has already validated the record extent.
+    uint32_t load_u32(size_t off) const {
+#if FFIRE_LITTLE_ENDIAN
+        uint32_t u;
+        std::memcpy(&u, data_ + off, 4);
+        return u;
+#else
+        return static_cast<uint32_t>(data_[off]) |
+               (static_cast<uint32_t>(data_[off + 1]) << 8) |
+               (static_cast<uint32_t>(data_[off + 2]) << 16) |
+               (static_cast<uint32_t>(data_[off + 3]) << 24);
+#endif
+    }
+
+    uint64_t load_u64(size_t off) const {
+#if FFIRE_LITTLE_ENDIAN
+        uint64_t u;
+        std::memcpy(&u, data_ + off, 8);
+        return u;
+#else
+        return static_cast<uint64_t>(load_u32(off)) |
+               (static_cast<uint64_t>(load_u32(off + 4)) << 32);
+#endif
+    }
+
+    float float_at(size_t off) const {
+        uint32_t u = load_u32(off);
+        float f;
+        std::memcpy(&f, &u, sizeof(float));
+        return f;
+    }
+
+    uint16_t string_len_at(size_t off) const {
+#if FFIRE_LITTLE_ENDIAN
+        uint16_t len;
+        std::memcpy(&len, data_ + off, 2);
+        return len;
+#else
+        return static_cast<uint16_t>(data_[off]) |
+               (static_cast<uint16_t>(data_[off + 1]) << 8);
+#endif
+    }
+
+    // String occupying [field_off, next_off): two length bytes then payload.
+    std::string_view string_at(size_t field_off, size_t next_off) const {
+        return std::string_view(reinterpret_cast<const char*>(data_ + field_off + 2),
+                                next_off - field_off - 2);
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t begin_ = 0;    // record start (DisplayName length prefix)
+    size_t fixed_a_ = 0;  // DefaultValue..MinValue block (20 bytes)
+    size_t unit_ = 0;     // Unit length prefix
+    size_t ident_ = 0;    // Identifier length prefix
+    size_t fixed_b_ = 0;  // CanRamp..RawFlags block (10 bytes)
+    size_t opt_ = 0;      // IndexedValues marker byte
+    size_t src_ = 0;      // IndexedValuesSource marker byte
+};
+
+class PluginView {
+public:
+    PluginView() = default;
+
+    std::string_view Name() const { return string_at(begin_, mfr_); }
+    std::string_view ManufacturerID() const { return string_at(mfr_, type_); }
+    std::string_view Type() const { return string_at(type_, subtype_); }
+    std::string_view Subtype() const { return string_at(subtype_, params_); }
+
+    uint16_t ParameterCount() const {
+        return static_cast<uint16_t>(data_[params_]) |
+               (static_cast<uint16_t>(data_[params_ + 1]) << 8);
+    }
+
+    class parameter_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ParameterView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ParameterView*;
+        using reference = const ParameterView&;
+
+        reference operator*() const { return view_; }
+        pointer operator->() const { return &view_; }
+
+        parameter_iterator& operator++() {
+            --remaining_;
+            if (remaining_ > 0) {
+                offset_ = view_.position(data_, size_, offset_);
+            }
+            return *this;
+        }
+
+        parameter_iterator operator++(int) {
+            parameter_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const parameter_iterator& other) const {
+            return remaining_ == other.remaining_;
+        }
+        bool operator!=(const parameter_iterator& other) const {
+            return remaining_ != other.remaining_;
+        }
+
+    private:
+        friend class PluginView;
+
+        parameter_iterator(const uint8_t* data, size_t size, size_t offset,
+                           uint16_t remaining)
+            : data_(data), size_(size), offset_(offset), remaining_(remaining) {
+            if (remaining_ > 0) {
+                offset_ = view_.position(data_, size_, offset_);
+            }
+        }
+
+        const uint8_t* data_ = nullptr;
+        size_t size_ = 0;
+        size_t offset_ = 0;
+        uint16_t remaining_ = 0;
+        ParameterView view_;
+    };
+
+    parameter_iterator begin() const {
+        return parameter_iterator(data_, size_, params_ + 2, ParameterCount());
+    }
+    parameter_iterator end() const { return parameter_iterator(data_, size_, 0, 0); }
+
+    // Parse the plugin record at `offset` and return the offset one past its
+    // end. Public so callers that manage their own record offsets (e.g. a
+    // lazy scan over a mapped file) can skip records without materializing
+    // them; PluginMessageView's iterator uses it the same way.
+    size_t position(const uint8_t* data, size_t size, size_t offset) {
+        Decoder dec(data, size);
+        dec.pos = offset;
+        data_ = data;
+        size_ = size;
+        begin_ = offset;
+        dec.read_string_view();                       // Name
+        mfr_ = dec.pos;
+        dec.read_string_view();                       // ManufacturerID
+        type_ = dec.pos;
+        dec.read_string_view();                       // Type
+        subtype_ = dec.pos;
+        dec.read_string_view();                       // Subtype
+        params_ = dec.pos;
+        uint16_t len = dec.read_array_length();
+        ParameterView param;
+        for (uint16_t i = 0; i < len; ++i) {
+            dec.pos = param.position(data, size, dec.pos);
+        }
+        return dec.pos;
+    }
+
+private:
+    std::string_view string_at(size_t field_off, size_t next_off) const {
+        return std::string_view(reinterpret_cast<const char*>(data_ + field_off + 2),
+                                next_off - field_off - 2);
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    size_t begin_ = 0;
+    size_t mfr_ = 0;
+    size_t type_ = 0;
+    size_t subtype_ = 0;
+    size_t params_ = 0;  // Parameters length prefix
+};
+
+class PluginMessageView {
+public:
+    PluginMessageView(const uint8_t* data, size_t size) : data_(data), size_(size) {
+        Decoder dec(data, size);
+        count_ = dec.read_array_length();
+    }
+    explicit PluginMessageView(const std::vector<uint8_t>& data)
+        : PluginMessageView(data.data(), data.size()) {}
+
+    uint16_t size() const { return count_; }
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = PluginView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const PluginView*;
+        using reference = const PluginView&;
+
+        reference operator*() const { return view_; }
+        pointer operator->() const { return &view_; }
+
+        iterator& operator++() {
+            --remaining_;
+            if (remaining_ > 0) {
+                offset_ = view_.position(data_, size_, offset_);
+            }
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const {
+            return remaining_ == other.remaining_;
+        }
+        bool operator!=(const iterator& other) const {
+            return remaining_ != other.remaining_;
+        }
+
+    private:
+        friend class PluginMessageView;
+
+        iterator(const uint8_t* data, size_t size, size_t offset, uint16_t remaining)
+            : data_(data), size_(size), offset_(offset), remaining_(remaining) {
+            if (remaining_ > 0) {
+                offset_ = view_.position(data_, size_, offset_);
+            }
+        }
+
+        const uint8_t* data_ = nullptr;
+        size_t size_ = 0;
+        size_t offset_ = 0;
+        uint16_t remaining_ = 0;
+        PluginView view_;
+    };
+
+    iterator begin() const { return iterator(data_, size_, 2, count_); }
+    iterator end() const { return iterator(data_, size_, 0, 0); }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    uint16_t count_ = 0;
+};
+
+// Frozen snapshot format
+//
+// freeze_plugin_message() lays a whole message out flat: a header, then
+// fixed-stride plugin and parameter records, then one shared string table.
+// Every reference is a 32-bit offset from the start of the image, so a
+// frozen file can be mmap'd and read as const structured data with zero
+// decode work. Records use native byte order and alignment — a snapshot is
+// machine-local cache data (written once per scan, read on every launch),
+// not an interchange format; the wire encoding remains the one that
+// crosses machines.
+
+// Offset/length reference into the image's string table.
+struct FrozenStr {
+    uint32_t Offset;
+    uint32_t Length;
+};
+
+struct FrozenParameter {
+    int64_t RawFlags;
+    FrozenStr DisplayName;
+    FrozenStr Unit;
+    FrozenStr Identifier;
+    float DefaultValue;
+    float CurrentValue;
+    int32_t Address;
+    float MaxValue;
+    float MinValue;
+    uint32_t IndexedValuesFirst;  // index into the image's FrozenStr pool
+    uint32_t IndexedValuesCount;
+    uint8_t CanRamp;
+    uint8_t IsWritable;
+    uint8_t HasIndexedValues;
+    uint8_t HasIndexedValuesSource;
+    FrozenStr IndexedValuesSource;
+};
+
+struct FrozenPlugin {
+    FrozenStr Name;
+    FrozenStr ManufacturerID;
+    FrozenStr Type;
+    FrozenStr Subtype;
+    uint32_t ParametersFirst;  // index into the parameter record array
+    uint32_t ParametersCount;
+};
+
+struct FrozenHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t PluginCount;
+    uint32_t ParameterCount;
+    uint32_t IndexedValueCount;     // entries in the FrozenStr pool
+    uint32_t PluginsOffset;
+    uint32_t ParametersOffset;
+    uint32_t IndexedValuesOffset;   // FrozenStr pool for IndexedValues
+    uint32_t StringsOffset;
+    uint32_t TotalSize;
+};
+
+constexpr uint32_t FrozenMagic = 0x5A524646;  // "FFRZ"
+constexpr uint32_t FrozenVersion = 1;
+
+static_assert(sizeof(FrozenStr) == 8, "frozen layout must be stable");
+static_assert(sizeof(FrozenParameter) == 72, "frozen layout must be stable");
+static_assert(sizeof(FrozenPlugin) == 40, "frozen layout must be stable");
+static_assert(sizeof(FrozenHeader) == 40, "frozen layout must be stable");
+
+namespace detail {
+
+template <typename PluginVecT>
+inline std::vector<uint8_t> freeze_message(const PluginVecT& value) {
+    // Pass 1: tally record and string-table sizes.
+    size_t param_count = 0;
+    size_t pool_count = 0;
+    size_t string_bytes = 0;
+    for (const auto& elem : value) {
+        string_bytes += elem.Name.size() + elem.ManufacturerID.size() +
+                        elem.Type.size() + elem.Subtype.size();
+        for (const auto& param : elem.Parameters) {
+            ++param_count;
+            string_bytes += param.DisplayName.size() + param.Unit.size() +
+                            param.Identifier.size();
+            if (param.IndexedValues.has_value()) {
+                pool_count += param.IndexedValues->size();
+                for (const auto& iv : param.IndexedValues.value()) {
+                    string_bytes += iv.size();
+                }
+            }
+            if (param.IndexedValuesSource.has_value()) {
+                string_bytes += param.IndexedValuesSource->size();
+            }
+        }
+    }
+
+    // Section layout; parameter records carry int64_t so keep them 8-aligned.
+    const size_t plugins_off = sizeof(FrozenHeader);
+    const size_t params_off =
+        (plugins_off + value.size() * sizeof(FrozenPlugin) + 7) & ~size_t(7);
+    const size_t pool_off = params_off + param_count * sizeof(FrozenParameter);
+    const size_t strings_off = pool_off + pool_count * sizeof(FrozenStr);
+    const size_t total = strings_off + string_bytes;
+
+    std::vector<uint8_t> image(total, 0);
+
+    FrozenHeader header = {};
+    header.Magic = FrozenMagic;
+    header.Version = FrozenVersion;
+    header.PluginCount = static_cast<uint32_t>(value.size());
+    header.ParameterCount = static_cast<uint32_t>(param_count);
+    header.IndexedValueCount = static_cast<uint32_t>(pool_count);
+    header.PluginsOffset = static_cast<uint32_t>(plugins_off);
+    header.ParametersOffset = static_cast<uint32_t>(params_off);
+    header.IndexedValuesOffset = static_cast<uint32_t>(pool_off);
+    header.StringsOffset = static_cast<uint32_t>(strings_off);
+    header.TotalSize = static_cast<uint32_t>(total);
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    // Pass 2: emit records; strings are appended to the table as seen.
+    size_t str_cursor = strings_off;
+    auto put_str = [&](std::string_view s) {
+        FrozenStr ref;
+        ref.Offset = static_cast<uint32_t>(str_cursor);
+        ref.Length = static_cast<uint32_t>(s.size());
+        std::memcpy(image.data() + str_cursor, s.data(), s.size());
+        str_cursor += s.size();
+        return ref;
+    };
+
+    size_t plugin_idx = 0;
+    size_t param_idx = 0;
+    size_t pool_idx = 0;
+    for (const auto& elem : value) {
+        FrozenPlugin rec = {};
+        rec.Name = put_str(elem.Name);
+        rec.ManufacturerID = put_str(elem.ManufacturerID);
+        rec.Type = put_str(elem.Type);
+        rec.Subtype = put_str(elem.Subtype);
+        rec.ParametersFirst = static_cast<uint32_t>(param_idx);
+        rec.ParametersCount = static_cast<uint32_t>(elem.Parameters.size());
+        std::memcpy(image.data() + plugins_off + plugin_idx * sizeof(rec), &rec,
+                    sizeof(rec));
+        ++plugin_idx;
+
+        for (const auto& param : elem.Parameters) {
+            FrozenParameter prec = {};
+            prec.RawFlags = param.RawFlags;
+            prec.DisplayName = put_str(param.DisplayName);
+            prec.Unit = put_str(param.Unit);
+            prec.Identifier = put_str(param.Identifier);
+            prec.DefaultValue = param.DefaultValue;
+            prec.CurrentValue = param.CurrentValue;
+            prec.Address = param.Address;
+            prec.MaxValue = param.MaxValue;
+            prec.MinValue = param.MinValue;
+            prec.CanRamp = param.CanRamp ? 0x01 : 0x00;
+            prec.IsWritable = param.IsWritable ? 0x01 : 0x00;
+            if (param.IndexedValues.has_value()) {
+                prec.HasIndexedValues = 0x01;
+                prec.IndexedValuesFirst = static_cast<uint32_t>(pool_idx);
+                prec.IndexedValuesCount =
+                    static_cast<uint32_t>(param.IndexedValues->size());
+                for (const auto& iv : param.IndexedValues.value()) {
+                    FrozenStr ref = put_str(iv);
+                    std::memcpy(image.data() + pool_off + pool_idx * sizeof(ref),
+                                &ref, sizeof(ref));
+                    ++pool_idx;
+                }
+            }
+            if (param.IndexedValuesSource.has_value()) {
+                prec.HasIndexedValuesSource = 0x01;
+                prec.IndexedValuesSource = put_str(param.IndexedValuesSource.value());
+            }
+            std::memcpy(image.data() + params_off + param_idx * sizeof(prec),
+                        &prec, sizeof(prec));
+            ++param_idx;
+        }
+    }
+    return image;
+}
+
+} // namespace detail
+
+// Freeze Message into a flat relocatable snapshot image
+inline std::vector<uint8_t> freeze_plugin_message(const std::vector<Plugin>& value) {
+    return detail::freeze_message(value);
+}
+inline std::vector<uint8_t> freeze_plugin_message(
+    const std::pmr::vector<pmr::Plugin>& value) {
+    return detail::freeze_message(value);
+}
+
+// Read-only accessor over a frozen image (typically an mmap'd snapshot
+// file). The constructor validates the header and section bounds once;
+// every accessor after that is plain pointer arithmetic.
+class FrozenMessageView {
+public:
+    FrozenMessageView(const uint8_t* data, size_t size) : data_(data) {
+        if (size < sizeof(FrozenHeader)) {
+            detail::raise_decode_error("frozen image too small");
+        }
+        std::memcpy(&header_, data, sizeof(header_));
+        if (header_.Magic != FrozenMagic) {
+            detail::raise_decode_error("not a frozen image");
+        }
+        if (header_.Version != FrozenVersion) {
+            detail::raise_decode_error("unsupported frozen image version");
+        }
+        if (header_.TotalSize > size ||
+            header_.PluginsOffset + header_.PluginCount * sizeof(FrozenPlugin) >
+                header_.TotalSize ||
+            header_.ParametersOffset +
+                    header_.ParameterCount * sizeof(FrozenParameter) >
+                header_.TotalSize ||
+            header_.IndexedValuesOffset +
+                    header_.IndexedValueCount * sizeof(FrozenStr) >
+                header_.TotalSize ||
+            header_.StringsOffset > header_.TotalSize) {
+            detail::raise_decode_error("truncated frozen image");
+        }
+    }
+    explicit FrozenMessageView(const std::vector<uint8_t>& data)
+        : FrozenMessageView(data.data(), data.size()) {}
+
+    uint32_t size() const { return header_.PluginCount; }
+
+    const FrozenPlugin& operator[](size_t index) const {
+        return *reinterpret_cast<const FrozenPlugin*>(
+            data_ + header_.PluginsOffset + index * sizeof(FrozenPlugin));
+    }
+
+    // First parameter record of a plugin; records are contiguous, so
+    // `parameters(p)[i]` addresses parameter i of ParametersCount.
+    const FrozenParameter* parameters(const FrozenPlugin& plugin) const {
+        return reinterpret_cast<const FrozenParameter*>(
+                   data_ + header_.ParametersOffset) +
+               plugin.ParametersFirst;
+    }
+
+    std::string_view str(FrozenStr ref) const {
+        return std::string_view(reinterpret_cast<const char*>(data_ + ref.Offset),
+                                ref.Length);
+    }
+
+    std::string_view indexed_value(const FrozenParameter& param, size_t index) const {
+        const FrozenStr* pool = reinterpret_cast<const FrozenStr*>(
+            data_ + header_.IndexedValuesOffset);
+        return str(pool[param.IndexedValuesFirst + index]);
+    }
+
+private:
+    const uint8_t* data_;
+    FrozenHeader header_;
+};
+
+// ---------------------------------------------------------------------------
+// Delta encoding for parameter value updates.
+//
+// Consecutive snapshots of a running session usually differ only in scalar
+// parameter fields — CurrentValue above all — yet a full re-encode re-sends
+// every string in the catalog. A delta captures just the changed fields as
+// fixed-size update records:
+//
+//     u32 record count, then per record:
+//     u16 plugin index | u16 parameter index | u8 field id | value
+//
+// The value width follows the field (4 bytes for floats and Address, 1 for
+// the flags, 8 for RawFlags), so a typical CurrentValue update costs
+// 9 bytes. Deltas cover the numeric and flag fields only; structural
+// changes (counts, names, indexed values) need a full re-encode, and
+// diff_plugin_message rejects pairs whose shapes differ.
+
+enum class DeltaField : uint8_t {
+    DefaultValue = 0,
+    CurrentValue = 1,
+    Address = 2,
+    MaxValue = 3,
+    MinValue = 4,
+    CanRamp = 5,
+    IsWritable = 6,
+    RawFlags = 7,
+};
+
+namespace detail {
+
+inline size_t delta_value_size(DeltaField field) {
+    switch (field) {
+        case DeltaField::CanRamp:
+        case DeltaField::IsWritable:
+            return 1;
+        case DeltaField::RawFlags:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+// Bit-exact float comparison, so NaN payloads and signed zeros survive a
+// diff/apply cycle unchanged.
+inline bool float_bits_differ(float a, float b) {
+    uint32_t ua, ub;
+    std::memcpy(&ua, &a, 4);
+    std::memcpy(&ub, &b, 4);
+    return ua != ub;
+}
+
+template <typename ParamT>
+inline void diff_parameter(const ParamT& from, const ParamT& to,
+                           uint32_t& count, size_t& bytes, Encoder* enc,
+                           uint16_t plugin_idx, uint16_t param_idx) {
+    auto emit = [&](DeltaField field) {
+        count++;
+        bytes += 5 + delta_value_size(field);
+        if (enc == nullptr) {
+            return;
+        }
+        enc->write_int16(static_cast<int16_t>(plugin_idx));
+        enc->write_int16(static_cast<int16_t>(param_idx));
+        enc->write_byte(static_cast<uint8_t>(field));
+        switch (field) {
+            case DeltaField::DefaultValue: enc->write_float32(to.DefaultValue); break;
+            case DeltaField::CurrentValue: enc->write_float32(to.CurrentValue); break;
+            case DeltaField::Address: enc->write_int32(to.Address); break;
+            case DeltaField::MaxValue: enc->write_float32(to.MaxValue); break;
+            case DeltaField::MinValue: enc->write_float32(to.MinValue); break;
+            case DeltaField::CanRamp: enc->write_bool(to.CanRamp); break;
+            case DeltaField::IsWritable: enc->write_bool(to.IsWritable); break;
+            case DeltaField::RawFlags: enc->write_int64(to.RawFlags); break;
+        }
+    };
+    if (float_bits_differ(from.DefaultValue, to.DefaultValue)) emit(DeltaField::DefaultValue);
+    if (float_bits_differ(from.CurrentValue, to.CurrentValue)) emit(DeltaField::CurrentValue);
+    if (from.Address != to.Address) emit(DeltaField::Address);
+    if (float_bits_differ(from.MaxValue, to.MaxValue)) emit(DeltaField::MaxValue);
+    if (float_bits_differ(from.MinValue, to.MinValue)) emit(DeltaField::MinValue);
+    if (from.CanRamp != to.CanRamp) emit(DeltaField::CanRamp);
+    if (from.IsWritable != to.IsWritable) emit(DeltaField::IsWritable);
+    if (from.RawFlags != to.RawFlags) emit(DeltaField::RawFlags);
+}
+
+template <typename PluginVecT>
+inline std::vector<uint8_t> diff_message(const PluginVecT& from,
+                                         const PluginVecT& to) {
+    if (from.size() != to.size()) {
+        raise_decode_error("delta diff requires matching catalog structure");
+    }
+    // Pass 1: count changed fields and size the buffer exactly.
+    uint32_t count = 0;
+    size_t bytes = 4;
+    for (size_t p = 0; p < to.size(); p++) {
+        if (from[p].Parameters.size() != to[p].Parameters.size()) {
+            raise_decode_error("delta diff requires matching catalog structure");
+        }
+        for (size_t i = 0; i < to[p].Parameters.size(); i++) {
+            diff_parameter(from[p].Parameters[i], to[p].Parameters[i],
+                           count, bytes, nullptr, 0, 0);
+        }
+    }
+    // Pass 2: encode.
+    Encoder enc(bytes);
+    enc.write_length_wide(count);
+    uint32_t c2 = 0;
+    size_t b2 = 0;
+    for (size_t p = 0; p < to.size(); p++) {
+        for (size_t i = 0; i < to[p].Parameters.size(); i++) {
+            diff_parameter(from[p].Parameters[i], to[p].Parameters[i],
+                           c2, b2, &enc,
+                           static_cast<uint16_t>(p), static_cast<uint16_t>(i));
+        }
+    }
+    return std::move(enc.buffer);
+}
+
+template <typename PluginVecT>
+inline void apply_delta(const uint8_t* data, size_t size, PluginVecT& msg) {
+    Decoder dec(data, size);
+    dec.check_remaining(4);
+    uint32_t count = static_cast<uint32_t>(dec.read_int32());
+    // Minimum record size is 6 bytes; reject inflated counts up front.
+    dec.check_remaining(static_cast<size_t>(count) * 6);
+    for (uint32_t r = 0; r < count; r++) {
+        uint16_t plugin_idx = static_cast<uint16_t>(dec.read_int16());
+        uint16_t param_idx = static_cast<uint16_t>(dec.read_int16());
+        dec.check_remaining(1);
+        DeltaField field = static_cast<DeltaField>(dec.data[dec.pos++]);
+        if (plugin_idx >= msg.size() ||
+            param_idx >= msg[plugin_idx].Parameters.size()) {
+            raise_decode_error("delta record index out of range");
+        }
+        auto& param = msg[plugin_idx].Parameters[param_idx];
+        switch (field) {
+            case DeltaField::DefaultValue: param.DefaultValue = dec.read_float32(); break;
+            case DeltaField::CurrentValue: param.CurrentValue = dec.read_float32(); break;
+            case DeltaField::Address: param.Address = dec.read_int32(); break;
+            case DeltaField::MaxValue: param.MaxValue = dec.read_float32(); break;
+            case DeltaField::MinValue: param.MinValue = dec.read_float32(); break;
+            case DeltaField::CanRamp: param.CanRamp = dec.read_bool(); break;
+            case DeltaField::IsWritable: param.IsWritable = dec.read_bool(); break;
+            case DeltaField::RawFlags: param.RawFlags = dec.read_int64(); break;
+            default:
+                raise_decode_error("unknown delta field id");
+        }
+    }
+}
+
+} // namespace detail
+
+// Compute the delta taking `from` to `to`. Both catalogs must have the same
+// plugin and parameter counts; an empty delta is 4 bytes.
+inline std::vector<uint8_t> diff_plugin_message(const std::vector<Plugin>& from,
+                                                const std::vector<Plugin>& to) {
+    return detail::diff_message(from, to);
+}
+
+inline std::vector<uint8_t> diff_plugin_message(
+    const std::pmr::vector<pmr::Plugin>& from,
+    const std::pmr::vector<pmr::Plugin>& to) {
+    return detail::diff_message(from, to);
+}
+
+// ---------------------------------------------------------------------------
+// Lock-free SPSC channel for real-time parameter value updates.
+//
+// An audio thread publishing CurrentValue changes cannot allocate, lock, or
+// wait. ValueRing is a fixed-capacity single-producer/single-consumer ring
+// of compact (Address, Value) records: push is wait-free and drops the
+// update when the ring is full (the next snapshot carries the value anyway),
+// pop and drain run on the consumer thread where allocation is fine.
+
+struct ValueUpdate {
+    int32_t Address;
+    float Value;
+};
+
+class ValueRing {
+public:
+    // Capacity is rounded up to a power of two; 1024 records is ~8 KB.
+    explicit ValueRing(size_t capacity = 1024) {
+        size_t cap = 1;
+        while (cap < capacity) {
+            cap <<= 1;
+        }
+        slots_.resize(cap);
+        mask_ = cap - 1;
+    }
+
+    // Producer side: wait-free, no allocation. Returns false when the ring
+    // is full and the update was dropped.
+    bool push(int32_t address, float value) noexcept {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) > mask_) {
+            return false;
+        }
+        slots_[tail & mask_] = {address, value};
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: returns false when the ring is empty.
+    bool pop(ValueUpdate& out) noexcept {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    std::vector<ValueUpdate> slots_;
+    size_t mask_ = 0;
+    // Producer and consumer cursors on separate cache lines so the two
+    // threads do not false-share.
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+namespace detail {
+
+// Apply pending updates to every parameter whose Address matches,
+// last-writer-wins. One pass over the ring plus one pass over the catalog,
+// so draining stays O(records + parameters) even for large catalogs.
+template <typename PluginVecT>
+inline size_t drain_ring(ValueRing& ring, PluginVecT& msg) {
+    std::unordered_map<int32_t, float> pending;
+    ValueUpdate u;
+    while (ring.pop(u)) {
+        pending[u.Address] = u.Value;
+    }
+    if (pending.empty()) {
+        return 0;
+    }
+    size_t applied = 0;
+    for (auto& plugin : msg) {
+        for (auto& param : plugin.Parameters) {
+            auto it = pending.find(param.Address);
+            if (it != pending.end()) {
+                param.CurrentValue = it->second;
+                ++applied;
+            }
+        }
+    }
+    return applied;
+}
+
+} // namespace detail
+
+// Drain every queued update into the catalog; returns the number of
+// parameter writes applied. Consumer-thread only.
+inline size_t drain_value_ring(ValueRing& ring, std::vector<Plugin>& msg) {
+    return detail::drain_ring(ring, msg);
+}
+
+inline size_t drain_value_ring(ValueRing& ring, std::pmr::vector<pmr::Plugin>& msg) {
+    return detail::drain_ring(ring, msg);
+}
+
+// Patch a decoded catalog in place with a delta from diff_plugin_message.
+// Bounds and record sizes are validated; no strings or containers are
+// touched, so application never allocates.
+inline void apply_plugin_delta(const uint8_t* data, size_t size,
+                               std::vector<Plugin>& msg) {
+    detail::apply_delta(data, size, msg);
+}
+
+inline void apply_plugin_delta(const std::vector<uint8_t>& data,
+                               std::vector<Plugin>& msg) {
+    detail::apply_delta(data.data(), data.size(), msg);
+}
+
+inline void apply_plugin_delta(const uint8_t* data, size_t size,
+                               std::pmr::vector<pmr::Plugin>& msg) {
+    detail::apply_delta(data, size, msg);
+}
+
+} // namespace test
+
+#endif // TEST_H
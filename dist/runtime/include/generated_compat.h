@@ -0,0 +1,39 @@
+#ifndef GENERATED_COMPAT_H
+#define GENERATED_COMPAT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Legacy entry points kept for bindings generated before the plugin_* C
+// ABI. Each forwards to its plugin_* successor in generated_c.h, so the
+// optimized runtime stays the only implementation behind every name.
+
+// message_* — bound by the Swift package (@_silgen_name declarations in
+// Sources/test/test.swift). Same signatures as the plugin_* originals.
+typedef void* MessageHandle;
+
+MessageHandle message_decode(const uint8_t* data, size_t len, char** error_msg);
+size_t message_encode(MessageHandle handle, uint8_t** out_data, char** error_msg);
+void message_free(MessageHandle handle);
+void message_free_data(uint8_t* data);
+void message_free_error(char* error_msg);
+
+// ffire_* — bound by the C# (DllImport) and Dart (DynamicLibrary.lookup)
+// packages. Errors are reported through a per-thread last-error string
+// instead of an out-parameter, and ffire_encode returns a runtime-owned
+// buffer whose first four bytes hold the payload length; both bindings
+// copy the payload out before the next call on the same thread.
+void* ffire_decode(const uint8_t* data, int32_t len);
+const uint8_t* ffire_encode(void* msg);
+void ffire_free(void* msg);
+const char* ffire_get_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GENERATED_COMPAT_H
@@ -0,0 +1,1295 @@
+#include "generated_c.h"
+#include "generated.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+
+#ifdef FFIRE_ENABLE_STATS
+#include <chrono>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Upstream resource that tallies what the arena had to request beyond its
+// retained buffer, so the buffer can grow to the high-water mark.
+class TallyUpstream : public std::pmr::memory_resource {
+public:
+    size_t allocated = 0;
+#ifdef FFIRE_ENABLE_STATS
+    size_t calls = 0;  // cumulative, never reset
+#endif
+
+private:
+    void* do_allocate(size_t bytes, size_t align) override {
+        allocated += bytes;
+#ifdef FFIRE_ENABLE_STATS
+        ++calls;
+#endif
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t align) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Internal wrapper structs
+struct PluginHandleImpl {
+    // Retained arena storage, grown to the high-water mark of past decodes
+    // so steady-state plugin_decode_into cycles allocate nothing.
+    std::vector<uint8_t> arena_buffer;
+    size_t arena_high_water = 0;
+    TallyUpstream upstream;
+    // Bump arena backing every string and vector of the decoded message;
+    // rebuilt over arena_buffer on each decode.
+    std::optional<std::pmr::monotonic_buffer_resource> arena;
+    // The vector is placement-constructed inside the arena and intentionally
+    // never destructed: monotonic deallocation is a no-op, so plugin_free
+    // releases the whole message by dropping the arena instead of walking
+    // thousands of element destructors.
+    std::pmr::vector<test::pmr::Plugin>* plugins = nullptr;
+    std::string error;
+    std::vector<uint8_t> encoded_data;
+
+    // Columnar projection for plugin_get_parameter_columns, built lazily
+    // and dropped whenever the handle's contents are replaced.
+    std::optional<test::ParameterColumns> columns;
+
+    // Memory-mapped source (plugin_open_mapped). Records are materialized
+    // into the arena on first access; offsets of scanned records are cached
+    // so repeated lookups do not re-walk the file.
+    void* map_base = nullptr;
+    size_t map_len = 0;
+    std::vector<size_t> plugin_offsets;  // record start offsets, [0, scanned)
+    std::vector<uint8_t> plugin_decoded; // 1 once materialized
+    size_t scanned = 0;                  // count of valid plugin_offsets
+
+    // Lookup indexes for plugin_find_parameter_by_identifier/_by_address:
+    // an open-addressing hash over Identifier and a flat sorted array over
+    // Address. Built lazily on first lookup, dropped whenever identifiers
+    // or addresses can change (decode, delta apply, builder mutations) —
+    // value-only updates leave them valid.
+    struct ParamRef {
+        uint32_t plugin;
+        uint32_t param;
+    };
+    struct ParamIndex {
+        std::vector<std::pair<std::string_view, ParamRef>> ident_entries;
+        std::vector<uint32_t> ident_slots;  // entry index + 1, 0 = empty
+        std::vector<std::pair<int32_t, ParamRef>> by_address;  // sorted
+    };
+    std::optional<ParamIndex> index;
+
+#ifdef FFIRE_ENABLE_STATS
+    // Cumulative instrumentation counters for plugin_get_stats.
+    FfireStats stats = {};
+#endif
+
+    ~PluginHandleImpl() {
+#ifndef _WIN32
+        if (map_base) {
+            munmap(map_base, map_len);
+        }
+#endif
+    }
+};
+
+using PluginVec = std::pmr::vector<test::pmr::Plugin>;
+
+// Decode `data` into the handle, reusing its retained arena buffer. Throws
+// on malformed input, leaving the handle empty but decodable-into again.
+static void decode_into_handle(PluginHandleImpl* impl, const uint8_t* data, size_t len) {
+#ifndef _WIN32
+    if (impl->map_base) {
+        munmap(impl->map_base, impl->map_len);
+        impl->map_base = nullptr;
+        impl->map_len = 0;
+        impl->plugin_offsets.clear();
+        impl->plugin_decoded.clear();
+        impl->scanned = 0;
+    }
+#endif
+    impl->columns.reset();
+    impl->index.reset();
+    impl->plugins = nullptr;
+    impl->arena.reset();
+    if (impl->arena_high_water > impl->arena_buffer.size()) {
+        impl->arena_buffer.resize(impl->arena_high_water);
+    }
+    impl->upstream.allocated = 0;
+    impl->arena.emplace(impl->arena_buffer.data(), impl->arena_buffer.size(),
+                        &impl->upstream);
+#ifdef FFIRE_ENABLE_STATS
+    auto stats_start = std::chrono::steady_clock::now();
+#endif
+    try {
+        void* slot = impl->arena->allocate(sizeof(PluginVec), alignof(PluginVec));
+        impl->plugins =
+            new (slot) PluginVec(test::decode_plugin_message(data, len, &*impl->arena));
+    } catch (...) {
+        void* slot = impl->arena->allocate(sizeof(PluginVec), alignof(PluginVec));
+        impl->plugins = new (slot) PluginVec(&*impl->arena);
+        throw;
+    }
+    size_t used = impl->arena_buffer.size() + impl->upstream.allocated;
+    if (used > impl->arena_high_water) {
+        impl->arena_high_water = used;
+    }
+#ifdef FFIRE_ENABLE_STATS
+    uint64_t ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - stats_start)
+            .count());
+    impl->stats.messages_decoded += 1;
+    impl->stats.bytes_decoded += len;
+    impl->stats.last_decode_ns = ns;
+    impl->stats.total_decode_ns += ns;
+#endif
+}
+
+// Like decode_into_handle for a fresh handle, but one record at a time so a
+// cancelled job stops at the next record boundary. Returns false when the
+// job was cancelled; throws on malformed input.
+static bool decode_async_into(PluginHandleImpl* impl, const uint8_t* data, size_t len,
+                              const std::atomic<bool>& cancelled) {
+    impl->arena.emplace(impl->arena_buffer.data(), impl->arena_buffer.size(),
+                        &impl->upstream);
+    void* slot = impl->arena->allocate(sizeof(PluginVec), alignof(PluginVec));
+    impl->plugins = new (slot) PluginVec(&*impl->arena);
+
+    test::Decoder dec(data, len);
+    dec.check_remaining(2);
+    uint16_t count = static_cast<uint16_t>(dec.read_int16());
+    if (count == 0) {
+        throw std::runtime_error("No plugins in message");
+    }
+    impl->plugins->reserve(count);
+    for (uint16_t i = 0; i < count; i++) {
+        if (cancelled.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        test::pmr::Plugin& plugin = impl->plugins->emplace_back(&*impl->arena);
+        test::detail::decode_plugin(dec, plugin, &*impl->arena);
+    }
+    size_t used = impl->arena_buffer.size() + impl->upstream.allocated;
+    if (used > impl->arena_high_water) {
+        impl->arena_high_water = used;
+    }
+    return true;
+}
+
+// Worker pool behind plugin_decode_async. Threads are started on first use
+// and joined when the process tears the pool down; queued jobs hold their
+// own copy of the input buffer.
+namespace {
+
+struct AsyncJob {
+    uint64_t id = 0;
+    std::vector<uint8_t> data;
+    FfireDecodeCallback callback = nullptr;
+    void* user_data = nullptr;
+    std::atomic<bool> cancelled{false};
+};
+
+class DecodePool {
+public:
+    static DecodePool& instance() {
+        static DecodePool pool;
+        return pool;
+    }
+
+    uint64_t submit(const uint8_t* data, size_t len, FfireDecodeCallback cb,
+                    void* user_data) {
+        auto job = std::make_shared<AsyncJob>();
+        job->data.assign(data, data + len);
+        job->callback = cb;
+        job->user_data = user_data;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) return 0;
+            job->id = next_id_++;
+            active_[job->id] = job;
+            queue_.push_back(job);
+            if (threads_.size() < max_threads_ && threads_.size() < queue_.size()) {
+                threads_.emplace_back([this] { worker(); });
+            }
+        }
+        cv_.notify_one();
+        return job->id;
+    }
+
+    int cancel(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = active_.find(id);
+        if (it == active_.end()) {
+            return 0;  // already completed or unknown
+        }
+        it->second->cancelled.store(true, std::memory_order_relaxed);
+        for (auto q = queue_.begin(); q != queue_.end(); ++q) {
+            if ((*q)->id == id) {
+                queue_.erase(q);
+                break;
+            }
+        }
+        active_.erase(it);
+        return 1;
+    }
+
+private:
+    DecodePool() : max_threads_(std::thread::hardware_concurrency() > 0
+                                    ? std::thread::hardware_concurrency()
+                                    : 2) {}
+
+    ~DecodePool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            queue_.clear();
+        }
+        cv_.notify_all();
+        for (auto& t : threads_) {
+            t.join();
+        }
+    }
+
+    void worker() {
+        for (;;) {
+            std::shared_ptr<AsyncJob> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (stopping_) return;
+                job = queue_.front();
+                queue_.pop_front();
+            }
+            run_job(job);
+        }
+    }
+
+    void run_job(const std::shared_ptr<AsyncJob>& job) {
+        PluginHandleImpl* handle = new PluginHandleImpl();
+        const char* error = nullptr;
+        bool finished = false;
+        try {
+            finished = decode_async_into(handle, job->data.data(), job->data.size(),
+                                         job->cancelled);
+        } catch (const std::exception& e) {
+            handle->error = e.what();
+            error = handle->error.c_str();
+        }
+        // Completion and cancellation are decided under the same lock, so a
+        // successful plugin_decode_cancel guarantees the callback never runs.
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (active_.erase(job->id) == 0) {
+                delete handle;  // cancelled mid-decode
+                return;
+            }
+        }
+        if (error) {
+            job->callback(nullptr, error, job->user_data);
+            delete handle;
+        } else if (finished) {
+            job->callback(handle, nullptr, job->user_data);
+        } else {
+            delete handle;  // cancelled, entry already gone from active_
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<AsyncJob>> queue_;
+    std::unordered_map<uint64_t, std::shared_ptr<AsyncJob>> active_;
+    std::vector<std::thread> threads_;
+    size_t max_threads_;
+    uint64_t next_id_ = 1;
+    bool stopping_ = false;
+};
+
+} // namespace
+
+// Materialize plugin `idx` from the mapping if it has not been decoded yet,
+// skip-scanning forward from the last known record offset. For eagerly
+// decoded handles this is a bounds check and a pointer. Returns nullptr on
+// out-of-range index or a malformed record.
+static test::pmr::Plugin* ensure_plugin(PluginHandleImpl* impl, size_t idx) {
+    if (idx >= impl->plugins->size()) return nullptr;
+    test::pmr::Plugin* plugin = &(*impl->plugins)[idx];
+    if (!impl->map_base || impl->plugin_decoded[idx]) return plugin;
+
+    const uint8_t* base = static_cast<const uint8_t*>(impl->map_base);
+    try {
+        test::PluginView scan;
+        while (impl->scanned <= idx) {
+            impl->plugin_offsets[impl->scanned] = scan.position(
+                base, impl->map_len, impl->plugin_offsets[impl->scanned - 1]);
+            ++impl->scanned;
+        }
+        test::Decoder dec(base, impl->map_len);
+        dec.pos = impl->plugin_offsets[idx];
+        test::detail::decode_plugin(dec, *plugin, &*impl->arena);
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+    impl->plugin_decoded[idx] = 1;
+    return plugin;
+}
+
+// Materialize every plugin before whole-message operations (encode). Throws
+// when the mapped file turns out to be truncated or malformed.
+static void ensure_all(PluginHandleImpl* impl) {
+    if (!impl->map_base) return;
+    for (size_t i = 0; i < impl->plugins->size(); ++i) {
+        if (!ensure_plugin(impl, i)) {
+            throw std::runtime_error("Malformed record in mapped catalog");
+        }
+    }
+}
+
+static test::pmr::Plugin* plugin_at(PluginHandle handle, size_t idx) {
+    if (!handle) return nullptr;
+    return ensure_plugin(static_cast<PluginHandleImpl*>(handle), idx);
+}
+
+// The plugin the builder calls currently target: the most recently started
+// record.
+static test::pmr::Plugin* last_plugin(PluginHandle handle) {
+    if (!handle) return nullptr;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    if (impl->plugins->empty()) return nullptr;
+    return ensure_plugin(impl, impl->plugins->size() - 1);
+}
+
+// ParameterHandle is a borrowed pointer straight into the handle's
+// Parameters vector: no allocation per access, nothing to free, valid for
+// the lifetime of the plugin handle.
+
+// Record a completed encode for plugin_get_stats; compiles to nothing when
+// instrumentation is off.
+#ifdef FFIRE_ENABLE_STATS
+static void note_encode(PluginHandleImpl* impl, size_t bytes) {
+    impl->stats.messages_encoded += 1;
+    impl->stats.bytes_encoded += bytes;
+}
+#else
+static void note_encode(PluginHandleImpl*, size_t) {}
+#endif
+
+// Helper to create error message
+static char* make_error_msg(const std::string& msg) {
+    char* error = new char[msg.size() + 1];
+    std::strcpy(error, msg.c_str());
+    return error;
+}
+
+static void fill_parameter_data(const test::pmr::Parameter& param, FfireParameterData* out) {
+    out->display_name = param.DisplayName.data();
+    out->display_name_len = param.DisplayName.size();
+    out->unit = param.Unit.data();
+    out->unit_len = param.Unit.size();
+    out->identifier = param.Identifier.data();
+    out->identifier_len = param.Identifier.size();
+    out->default_value = param.DefaultValue;
+    out->current_value = param.CurrentValue;
+    out->max_value = param.MaxValue;
+    out->min_value = param.MinValue;
+    out->address = param.Address;
+    out->raw_flags = param.RawFlags;
+    out->can_ramp = param.CanRamp ? 1 : 0;
+    out->is_writable = param.IsWritable ? 1 : 0;
+    out->indexed_values_count =
+        param.IndexedValues.has_value() ? param.IndexedValues->size() : 0;
+    if (param.IndexedValuesSource.has_value()) {
+        out->indexed_values_source = param.IndexedValuesSource->data();
+        out->indexed_values_source_len = param.IndexedValuesSource->size();
+    } else {
+        out->indexed_values_source = nullptr;
+        out->indexed_values_source_len = 0;
+    }
+}
+
+static const test::pmr::Parameter* param_at(PluginHandle handle, size_t plugin_idx,
+                                       size_t param_idx) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, plugin_idx);
+    if (!plugin) return nullptr;
+    if (param_idx >= plugin->Parameters.size()) return nullptr;
+    return &plugin->Parameters[param_idx];
+}
+
+static size_t fnv1a(const char* data, size_t len) {
+    size_t h = 1469598103934665603ull;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Build the Identifier hash table and the Address array across the whole
+// message. Duplicate identifiers and addresses keep the first occurrence in
+// message order: the hash probe stops at the first match, and by_address is
+// stable-sorted so lower_bound lands on the earliest entry per key.
+static PluginHandleImpl::ParamIndex* ensure_index(PluginHandleImpl* impl) {
+    if (impl->index) return &*impl->index;
+    ensure_all(impl);
+
+    PluginHandleImpl::ParamIndex idx;
+    for (size_t i = 0; i < impl->plugins->size(); ++i) {
+        const test::pmr::Plugin& plugin = (*impl->plugins)[i];
+        for (size_t j = 0; j < plugin.Parameters.size(); ++j) {
+            const test::pmr::Parameter& param = plugin.Parameters[j];
+            PluginHandleImpl::ParamRef ref = {static_cast<uint32_t>(i),
+                                              static_cast<uint32_t>(j)};
+            idx.ident_entries.emplace_back(
+                std::string_view(param.Identifier.data(), param.Identifier.size()), ref);
+            idx.by_address.emplace_back(param.Address, ref);
+        }
+    }
+    std::stable_sort(idx.by_address.begin(), idx.by_address.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // Open addressing with linear probing, load factor <= 0.5. Inserting in
+    // message order makes the first duplicate the one every probe finds.
+    size_t slots = 16;
+    while (slots < idx.ident_entries.size() * 2) slots *= 2;
+    idx.ident_slots.assign(slots, 0);
+    for (size_t e = 0; e < idx.ident_entries.size(); ++e) {
+        const std::string_view key = idx.ident_entries[e].first;
+        size_t slot = fnv1a(key.data(), key.size()) & (slots - 1);
+        for (;;) {
+            uint32_t occupant = idx.ident_slots[slot];
+            if (occupant == 0) {
+                idx.ident_slots[slot] = static_cast<uint32_t>(e) + 1;
+                break;
+            }
+            if (idx.ident_entries[occupant - 1].first == key) break;  // duplicate
+            slot = (slot + 1) & (slots - 1);
+        }
+    }
+
+    impl->index.emplace(std::move(idx));
+    return &*impl->index;
+}
+
+extern "C" {
+
+PluginHandle plugin_decode(const uint8_t* data, size_t len, char** error_msg) {
+    if (!data || len == 0) {
+        if (error_msg) *error_msg = make_error_msg("Invalid input data");
+        return nullptr;
+    }
+    
+    PluginHandleImpl* handle = new PluginHandleImpl;
+    try {
+        // Decode the message into the handle's arena
+        decode_into_handle(handle, data, len);
+
+        if (handle->plugins->empty()) {
+            if (error_msg) *error_msg = make_error_msg("No plugins in message");
+            delete handle;
+            return nullptr;
+        }
+
+        return static_cast<PluginHandle>(handle);
+    } catch (const std::exception& e) {
+        delete handle;
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return nullptr;
+    }
+}
+
+int plugin_decode_into(PluginHandle handle, const uint8_t* data, size_t len, char** error_msg) {
+    if (!handle || !data || len == 0) {
+        if (error_msg) *error_msg = make_error_msg("Invalid input data");
+        return 0;
+    }
+
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        decode_into_handle(impl, data, len);
+
+        if (impl->plugins->empty()) {
+            if (error_msg) *error_msg = make_error_msg("No plugins in message");
+            return 0;
+        }
+
+        return 1;
+    } catch (const std::exception& e) {
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return 0;
+    }
+}
+
+void plugin_reserve(PluginHandle handle, size_t plugins, size_t params_per_plugin) {
+    if (!handle) return;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    // Rough per-record footprint including typical string payloads; the
+    // high-water tracking corrects the estimate after the first decode.
+    size_t estimate = sizeof(PluginVec) +
+                      plugins * (sizeof(test::pmr::Plugin) + 64) +
+                      plugins * params_per_plugin * (sizeof(test::pmr::Parameter) + 96);
+    if (estimate > impl->arena_high_water) {
+        impl->arena_high_water = estimate;
+    }
+}
+
+PluginHandle plugin_open_mapped(const char* path, char** error_msg) {
+#ifdef _WIN32
+    (void)path;
+    if (error_msg) *error_msg = make_error_msg("Mapped open is not supported on this platform");
+    return nullptr;
+#else
+    if (!path) {
+        if (error_msg) *error_msg = make_error_msg("Invalid path");
+        return nullptr;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (error_msg) *error_msg = make_error_msg(std::string("Cannot open ") + path);
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 2) {
+        close(fd);
+        if (error_msg) *error_msg = make_error_msg("Invalid catalog file");
+        return nullptr;
+    }
+    size_t len = static_cast<size_t>(st.st_size);
+    void* base = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping keeps the file alive
+    if (base == MAP_FAILED) {
+        if (error_msg) *error_msg = make_error_msg("Cannot map catalog file");
+        return nullptr;
+    }
+
+    PluginHandleImpl* handle = new PluginHandleImpl;
+    handle->map_base = base;
+    handle->map_len = len;
+    try {
+        const uint8_t* data = static_cast<const uint8_t*>(base);
+        uint16_t count = static_cast<uint16_t>(data[0]) |
+                         (static_cast<uint16_t>(data[1]) << 8);
+        if (count == 0) {
+            if (error_msg) *error_msg = make_error_msg("No plugins in message");
+            delete handle;
+            return nullptr;
+        }
+
+        // Same arena setup as decode_into_handle, but the vector starts as
+        // `count` empty records; ensure_plugin fills each on first access.
+        handle->arena.emplace(handle->arena_buffer.data(),
+                              handle->arena_buffer.size(), &handle->upstream);
+        void* slot = handle->arena->allocate(sizeof(PluginVec), alignof(PluginVec));
+        handle->plugins = new (slot) PluginVec(&*handle->arena);
+        handle->plugins->reserve(count);
+        for (uint16_t i = 0; i < count; ++i) {
+            handle->plugins->emplace_back(&*handle->arena);
+        }
+        handle->plugin_offsets.resize(count);
+        handle->plugin_offsets[0] = 2;  // first record follows the count
+        handle->plugin_decoded.assign(count, 0);
+        handle->scanned = 1;
+
+        return static_cast<PluginHandle>(handle);
+    } catch (const std::exception& e) {
+        delete handle;
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return nullptr;
+    }
+#endif
+}
+
+uint64_t plugin_decode_async(const uint8_t* data, size_t len,
+                             FfireDecodeCallback callback, void* user_data) {
+    if (!data || len == 0 || !callback) {
+        return 0;
+    }
+    try {
+        return DecodePool::instance().submit(data, len, callback, user_data);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+int plugin_decode_cancel(uint64_t job_id) {
+    if (job_id == 0) return 0;
+    return DecodePool::instance().cancel(job_id);
+}
+
+size_t plugin_encode(PluginHandle handle, uint8_t** out_data, char** error_msg) {
+    if (!handle) {
+        if (error_msg) *error_msg = make_error_msg("Invalid handle");
+        return 0;
+    }
+    
+    try {
+        PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+        ensure_all(impl);
+
+        // Encode the full vector (not just first plugin), reusing the
+        // retained buffer's capacity across calls
+        impl->encoded_data.resize(test::encoded_size(*impl->plugins));
+        test::encode_plugin_message_into(*impl->plugins, impl->encoded_data.data());
+
+        // Allocate new buffer for caller
+        *out_data = new uint8_t[impl->encoded_data.size()];
+        std::memcpy(*out_data, impl->encoded_data.data(), impl->encoded_data.size());
+
+        note_encode(impl, impl->encoded_data.size());
+        return impl->encoded_data.size();
+    } catch (const std::exception& e) {
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return 0;
+    }
+}
+
+size_t plugin_encode_release(PluginHandle handle, uint8_t** out_data, char** error_msg) {
+    if (!handle) {
+        if (error_msg) *error_msg = make_error_msg("Invalid handle");
+        return 0;
+    }
+
+    try {
+        PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+        ensure_all(impl);
+
+        // Encode straight into the caller's buffer: no copy retained on the
+        // handle, no second allocation.
+        size_t size = test::encoded_size(*impl->plugins);
+        uint8_t* buffer = new uint8_t[size];
+        test::encode_plugin_message_into(*impl->plugins, buffer);
+
+        *out_data = buffer;
+        note_encode(impl, size);
+        return size;
+    } catch (const std::exception& e) {
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return 0;
+    }
+}
+
+size_t plugin_encode_into(PluginHandle handle, uint8_t* buf, size_t cap, char** error_msg) {
+    if (!handle) {
+        if (error_msg) *error_msg = make_error_msg("Invalid handle");
+        return 0;
+    }
+
+    try {
+        PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+        ensure_all(impl);
+
+        size_t size = test::encoded_size(*impl->plugins);
+        if (!buf || cap < size) {
+            if (error_msg) *error_msg = make_error_msg("Buffer too small for encoded message");
+            return size;  // tells the caller how much to allocate
+        }
+
+        test::encode_plugin_message_into(*impl->plugins, buf);
+        note_encode(impl, size);
+        return size;
+    } catch (const std::exception& e) {
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return 0;
+    }
+}
+
+ValueRingHandle plugin_rt_ring_create(size_t capacity) {
+    try {
+        return new test::ValueRing(capacity);
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void plugin_rt_ring_free(ValueRingHandle ring) {
+    delete static_cast<test::ValueRing*>(ring);
+}
+
+int plugin_rt_push_value(ValueRingHandle ring, int32_t address, float value) {
+    if (!ring) return 0;
+    // Wait-free: no allocation, no locks, no exceptions on this path.
+    return static_cast<test::ValueRing*>(ring)->push(address, value) ? 1 : 0;
+}
+
+size_t plugin_rt_drain(ValueRingHandle ring, PluginHandle handle) {
+    if (!ring || !handle) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        // Updates may target any record, so mapped handles materialize
+        // everything; the columnar cache goes stale once values change.
+        ensure_all(impl);
+        size_t applied =
+            test::drain_value_ring(*static_cast<test::ValueRing*>(ring), *impl->plugins);
+        if (applied > 0) {
+            impl->columns.reset();
+        }
+        return applied;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+int plugin_apply_delta(PluginHandle handle, const uint8_t* data, size_t len, char** error_msg) {
+    if (!handle || !data) {
+        if (error_msg) *error_msg = make_error_msg("Invalid input data");
+        return 0;
+    }
+
+    try {
+        PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+        // Mapped handles materialize everything first: a delta may touch any
+        // record, and patched values must survive later lazy lookups.
+        ensure_all(impl);
+        impl->columns.reset();
+        impl->index.reset();  // a delta may rewrite Address
+
+        test::apply_plugin_delta(data, len, *impl->plugins);
+        return 1;
+    } catch (const std::exception& e) {
+        if (error_msg) *error_msg = make_error_msg(e.what());
+        return 0;
+    }
+}
+
+void plugin_free(PluginHandle handle) {
+    delete static_cast<PluginHandleImpl*>(handle);
+}
+
+void plugin_free_data(uint8_t* data) {
+    delete[] data;
+}
+
+void plugin_free_error(char* error_msg) {
+    delete[] error_msg;
+}
+
+// Hand a string field to the caller as a pointer+length pair, skipping the
+// strlen and copy every binding would otherwise do at the crossing.
+static int view_out(const std::pmr::string& s, const char** out_data, size_t* out_len) {
+    *out_data = s.data();
+    *out_len = s.size();
+    return 1;
+}
+
+const char* plugin_get_name(PluginHandle handle) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    return plugin ? plugin->Name.c_str() : nullptr;
+}
+
+int plugin_get_name_view(PluginHandle handle, const char** out_data, size_t* out_len) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin || !out_data || !out_len) return 0;
+    return view_out(plugin->Name, out_data, out_len);
+}
+
+const char* plugin_get_manufacturer_id(PluginHandle handle) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    return plugin ? plugin->ManufacturerID.c_str() : nullptr;
+}
+
+int plugin_get_manufacturer_id_view(PluginHandle handle, const char** out_data, size_t* out_len) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin || !out_data || !out_len) return 0;
+    return view_out(plugin->ManufacturerID, out_data, out_len);
+}
+
+const char* plugin_get_type(PluginHandle handle) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    return plugin ? plugin->Type.c_str() : nullptr;
+}
+
+int plugin_get_type_view(PluginHandle handle, const char** out_data, size_t* out_len) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin || !out_data || !out_len) return 0;
+    return view_out(plugin->Type, out_data, out_len);
+}
+
+const char* plugin_get_subtype(PluginHandle handle) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    return plugin ? plugin->Subtype.c_str() : nullptr;
+}
+
+int plugin_get_subtype_view(PluginHandle handle, const char** out_data, size_t* out_len) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin || !out_data || !out_len) return 0;
+    return view_out(plugin->Subtype, out_data, out_len);
+}
+
+size_t plugin_get_parameters_count(PluginHandle handle) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    return plugin ? plugin->Parameters.size() : 0;
+}
+
+ParameterHandle plugin_get_parameter(PluginHandle handle, size_t index) {
+    test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin || index >= plugin->Parameters.size()) {
+        return nullptr;
+    }
+
+    return &plugin->Parameters[index];
+}
+
+int plugin_get_parameter_data(PluginHandle handle, size_t index, FfireParameterData* out) {
+    if (!out) return 0;
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin || index >= plugin->Parameters.size()) {
+        return 0;
+    }
+    fill_parameter_data(plugin->Parameters[index], out);
+    return 1;
+}
+
+size_t plugin_get_parameters_bulk(PluginHandle handle, size_t start, size_t count,
+                                  FfireParameterData* out_array) {
+    if (!out_array) return 0;
+    const test::pmr::Plugin* plugin = plugin_at(handle, 0);
+    if (!plugin) return 0;
+    const auto& params = plugin->Parameters;
+    if (start >= params.size()) {
+        return 0;
+    }
+    size_t end = start + count;
+    if (end > params.size()) {
+        end = params.size();
+    }
+    for (size_t i = start; i < end; ++i) {
+        fill_parameter_data(params[i], &out_array[i - start]);
+    }
+    return end - start;
+}
+
+PluginHandle plugin_create(void) {
+    try {
+        PluginHandleImpl* impl = new PluginHandleImpl();
+        impl->arena.emplace(impl->arena_buffer.data(), impl->arena_buffer.size(),
+                            &impl->upstream);
+        void* slot = impl->arena->allocate(sizeof(PluginVec), alignof(PluginVec));
+        impl->plugins = new (slot) PluginVec(&*impl->arena);
+        impl->plugins->emplace_back(&*impl->arena);
+        return impl;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+int plugin_append_plugin(PluginHandle handle) {
+    if (!handle) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        impl->columns.reset();
+        impl->index.reset();
+        impl->plugins->emplace_back(&*impl->arena);
+        if (impl->map_base) {
+            // Keep the lazy-decode bookkeeping aligned; a built record never
+            // needs materializing from the mapping.
+            impl->plugin_offsets.push_back(0);
+            impl->plugin_decoded.push_back(1);
+        }
+        return 1;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+// Copy `len` bytes into an arena-backed field; the builder's only copy of
+// each string.
+static int set_string_field(std::pmr::string& field, const char* data, size_t len) {
+    if (!data && len > 0) return 0;
+    field.assign(data ? data : "", len);
+    return 1;
+}
+
+int plugin_set_name(PluginHandle handle, const char* data, size_t len) {
+    test::pmr::Plugin* plugin = last_plugin(handle);
+    if (!plugin) return 0;
+    return set_string_field(plugin->Name, data, len);
+}
+
+int plugin_set_manufacturer_id(PluginHandle handle, const char* data, size_t len) {
+    test::pmr::Plugin* plugin = last_plugin(handle);
+    if (!plugin) return 0;
+    return set_string_field(plugin->ManufacturerID, data, len);
+}
+
+int plugin_set_type(PluginHandle handle, const char* data, size_t len) {
+    test::pmr::Plugin* plugin = last_plugin(handle);
+    if (!plugin) return 0;
+    return set_string_field(plugin->Type, data, len);
+}
+
+int plugin_set_subtype(PluginHandle handle, const char* data, size_t len) {
+    test::pmr::Plugin* plugin = last_plugin(handle);
+    if (!plugin) return 0;
+    return set_string_field(plugin->Subtype, data, len);
+}
+
+int plugin_add_parameter(PluginHandle handle, const FfireParameterData* data) {
+    test::pmr::Plugin* plugin = last_plugin(handle);
+    if (!plugin || !data) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        impl->columns.reset();
+        impl->index.reset();
+        test::pmr::Parameter& param = plugin->Parameters.emplace_back(&*impl->arena);
+        if (!set_string_field(param.DisplayName, data->display_name, data->display_name_len) ||
+            !set_string_field(param.Unit, data->unit, data->unit_len) ||
+            !set_string_field(param.Identifier, data->identifier, data->identifier_len)) {
+            plugin->Parameters.pop_back();
+            return 0;
+        }
+        param.DefaultValue = data->default_value;
+        param.CurrentValue = data->current_value;
+        param.MaxValue = data->max_value;
+        param.MinValue = data->min_value;
+        param.Address = data->address;
+        param.RawFlags = data->raw_flags;
+        param.CanRamp = data->can_ramp != 0;
+        param.IsWritable = data->is_writable != 0;
+        if (data->indexed_values_source) {
+            param.IndexedValuesSource.emplace(data->indexed_values_source,
+                                              data->indexed_values_source_len,
+                                              &*impl->arena);
+        }
+        return 1;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+int plugin_add_indexed_value(PluginHandle handle, const char* data, size_t len) {
+    test::pmr::Plugin* plugin = last_plugin(handle);
+    if (!plugin || plugin->Parameters.empty()) return 0;
+    if (!data && len > 0) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        test::pmr::Parameter& param = plugin->Parameters.back();
+        if (!param.IndexedValues.has_value()) {
+            param.IndexedValues.emplace(&*impl->arena);
+        }
+        // The pmr vector propagates its arena allocator to the new string.
+        param.IndexedValues->emplace_back(data ? data : "", len);
+        return 1;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+int plugin_get_parameter_columns(PluginHandle handle, FfireParameterColumns* out) {
+    if (!handle || !out) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        if (!impl->columns.has_value()) {
+            ensure_all(impl);
+            impl->columns = test::detail::build_columns(*impl->plugins);
+        }
+    } catch (const std::exception&) {
+        return 0;
+    }
+    const test::ParameterColumns& cols = *impl->columns;
+    out->parameter_count = cols.parameter_count();
+    out->parameters_first = cols.ParametersFirst.data();
+    out->parameters_count = cols.ParametersCount.data();
+    out->plugin_count = cols.plugin_count();
+    out->default_value = cols.DefaultValue.data();
+    out->current_value = cols.CurrentValue.data();
+    out->address = cols.Address.data();
+    out->max_value = cols.MaxValue.data();
+    out->min_value = cols.MinValue.data();
+    out->raw_flags = cols.RawFlags.data();
+    out->can_ramp = cols.CanRamp.data();
+    out->is_writable = cols.IsWritable.data();
+    return 1;
+}
+
+int plugin_get_stats(PluginHandle handle, FfireStats* out) {
+    if (!out) return 0;
+    std::memset(out, 0, sizeof(*out));
+    if (!handle) return 0;
+#ifdef FFIRE_ENABLE_STATS
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    *out = impl->stats;
+    out->alloc_count = impl->upstream.calls;
+    out->arena_high_water = impl->arena_high_water;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+const char* parameter_get_display_name(ParameterHandle handle) {
+    if (!handle) return nullptr;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->DisplayName.c_str();
+}
+
+int parameter_get_display_name_view(ParameterHandle handle, const char** out_data, size_t* out_len) {
+    if (!handle || !out_data || !out_len) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return view_out(param->DisplayName, out_data, out_len);
+}
+
+float parameter_get_default_value(ParameterHandle handle) {
+    if (!handle) return 0.0f;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->DefaultValue;
+}
+
+float parameter_get_current_value(ParameterHandle handle) {
+    if (!handle) return 0.0f;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->CurrentValue;
+}
+
+int32_t parameter_get_address(ParameterHandle handle) {
+    if (!handle) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->Address;
+}
+
+float parameter_get_max_value(ParameterHandle handle) {
+    if (!handle) return 0.0f;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->MaxValue;
+}
+
+float parameter_get_min_value(ParameterHandle handle) {
+    if (!handle) return 0.0f;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->MinValue;
+}
+
+const char* parameter_get_unit(ParameterHandle handle) {
+    if (!handle) return nullptr;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->Unit.c_str();
+}
+
+int parameter_get_unit_view(ParameterHandle handle, const char** out_data, size_t* out_len) {
+    if (!handle || !out_data || !out_len) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return view_out(param->Unit, out_data, out_len);
+}
+
+const char* parameter_get_identifier(ParameterHandle handle) {
+    if (!handle) return nullptr;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->Identifier.c_str();
+}
+
+int parameter_get_identifier_view(ParameterHandle handle, const char** out_data, size_t* out_len) {
+    if (!handle || !out_data || !out_len) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return view_out(param->Identifier, out_data, out_len);
+}
+
+int parameter_get_can_ramp(ParameterHandle handle) {
+    if (!handle) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->CanRamp ? 1 : 0;
+}
+
+int parameter_get_is_writable(ParameterHandle handle) {
+    if (!handle) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->IsWritable ? 1 : 0;
+}
+
+int64_t parameter_get_raw_flags(ParameterHandle handle) {
+    if (!handle) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    return param->RawFlags;
+}
+
+size_t parameter_get_indexed_values_count(ParameterHandle handle) {
+    if (!handle) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    if (!param->IndexedValues.has_value()) {
+        return 0;
+    }
+    return param->IndexedValues->size();
+}
+
+const char* parameter_get_indexed_value(ParameterHandle handle, size_t index) {
+    if (!handle) return nullptr;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    if (!param->IndexedValues.has_value()) {
+        return nullptr;
+    }
+    if (index >= param->IndexedValues->size()) {
+        return nullptr;
+    }
+    return (*param->IndexedValues)[index].c_str();
+}
+
+int parameter_get_indexed_value_view(ParameterHandle handle, size_t index,
+                                     const char** out_data, size_t* out_len) {
+    if (!handle || !out_data || !out_len) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    if (!param->IndexedValues.has_value() || index >= param->IndexedValues->size()) {
+        return 0;
+    }
+    return view_out((*param->IndexedValues)[index], out_data, out_len);
+}
+
+const char* parameter_get_indexed_values_source(ParameterHandle handle) {
+    if (!handle) return nullptr;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    if (!param->IndexedValuesSource.has_value()) {
+        return nullptr;
+    }
+    return param->IndexedValuesSource->c_str();
+}
+
+int parameter_get_indexed_values_source_view(ParameterHandle handle,
+                                             const char** out_data, size_t* out_len) {
+    if (!handle || !out_data || !out_len) return 0;
+    const test::pmr::Parameter* param = static_cast<const test::pmr::Parameter*>(handle);
+    if (!param->IndexedValuesSource.has_value()) {
+        return 0;
+    }
+    return view_out(*param->IndexedValuesSource, out_data, out_len);
+}
+
+size_t plugin_get_plugins_count(PluginHandle handle) {
+    if (!handle) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    return impl->plugins->size();
+}
+
+size_t plugin_get_parameters_count_at(PluginHandle handle, size_t plugin_idx) {
+    const test::pmr::Plugin* plugin = plugin_at(handle, plugin_idx);
+    return plugin ? plugin->Parameters.size() : 0;
+}
+
+int plugin_find_parameter_by_identifier(PluginHandle handle, const char* identifier,
+                                        size_t len, size_t* plugin_idx, size_t* param_idx) {
+    if (!handle || !identifier || !plugin_idx || !param_idx) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        const PluginHandleImpl::ParamIndex* idx = ensure_index(impl);
+        const std::string_view key(identifier, len);
+        size_t mask = idx->ident_slots.size() - 1;
+        size_t slot = fnv1a(identifier, len) & mask;
+        for (;;) {
+            uint32_t occupant = idx->ident_slots[slot];
+            if (occupant == 0) return 0;
+            const auto& entry = idx->ident_entries[occupant - 1];
+            if (entry.first == key) {
+                *plugin_idx = entry.second.plugin;
+                *param_idx = entry.second.param;
+                return 1;
+            }
+            slot = (slot + 1) & mask;
+        }
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+int plugin_find_parameter_by_address(PluginHandle handle, int32_t address,
+                                     size_t* plugin_idx, size_t* param_idx) {
+    if (!handle || !plugin_idx || !param_idx) return 0;
+    PluginHandleImpl* impl = static_cast<PluginHandleImpl*>(handle);
+    try {
+        const PluginHandleImpl::ParamIndex* idx = ensure_index(impl);
+        auto it = std::lower_bound(
+            idx->by_address.begin(), idx->by_address.end(), address,
+            [](const auto& entry, int32_t key) { return entry.first < key; });
+        if (it == idx->by_address.end() || it->first != address) return 0;
+        *plugin_idx = it->second.plugin;
+        *param_idx = it->second.param;
+        return 1;
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+const char* plugin_parameter_get_display_name(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->DisplayName.c_str() : nullptr;
+}
+
+int plugin_parameter_get_display_name_view(PluginHandle handle, size_t plugin_idx, size_t param_idx,
+                                           const char** out_data, size_t* out_len) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    if (!param || !out_data || !out_len) return 0;
+    return view_out(param->DisplayName, out_data, out_len);
+}
+
+float plugin_parameter_get_default_value(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->DefaultValue : 0.0f;
+}
+
+float plugin_parameter_get_current_value(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->CurrentValue : 0.0f;
+}
+
+int32_t plugin_parameter_get_address(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->Address : 0;
+}
+
+float plugin_parameter_get_max_value(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->MaxValue : 0.0f;
+}
+
+float plugin_parameter_get_min_value(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->MinValue : 0.0f;
+}
+
+const char* plugin_parameter_get_unit(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->Unit.c_str() : nullptr;
+}
+
+int plugin_parameter_get_unit_view(PluginHandle handle, size_t plugin_idx, size_t param_idx,
+                                   const char** out_data, size_t* out_len) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    if (!param || !out_data || !out_len) return 0;
+    return view_out(param->Unit, out_data, out_len);
+}
+
+const char* plugin_parameter_get_identifier(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->Identifier.c_str() : nullptr;
+}
+
+int plugin_parameter_get_identifier_view(PluginHandle handle, size_t plugin_idx, size_t param_idx,
+                                         const char** out_data, size_t* out_len) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    if (!param || !out_data || !out_len) return 0;
+    return view_out(param->Identifier, out_data, out_len);
+}
+
+int plugin_parameter_get_can_ramp(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return (param && param->CanRamp) ? 1 : 0;
+}
+
+int plugin_parameter_get_is_writable(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return (param && param->IsWritable) ? 1 : 0;
+}
+
+int64_t plugin_parameter_get_raw_flags(PluginHandle handle, size_t plugin_idx, size_t param_idx) {
+    const test::pmr::Parameter* param = param_at(handle, plugin_idx, param_idx);
+    return param ? param->RawFlags : 0;
+}
+
+} // extern "C"
@@ -0,0 +1,87 @@
+#include "generated_compat.h"
+#include "generated_c.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Per-thread state behind the ffire_* error and encode conventions: the
+// C# and Dart bindings poll ffire_get_error after a failure and copy the
+// encode payload out immediately, so one retained buffer per thread is
+// enough and repeat calls allocate nothing once it has grown.
+namespace {
+
+thread_local std::string g_last_error;
+thread_local std::vector<uint8_t> g_encode_buf;
+
+void set_last_error(char* error_msg) {
+    g_last_error = error_msg ? error_msg : "Unknown error";
+    plugin_free_error(error_msg);
+}
+
+} // namespace
+
+extern "C" {
+
+// message_* — Swift package entry points; signature-identical forwards.
+
+MessageHandle message_decode(const uint8_t* data, size_t len, char** error_msg) {
+    return plugin_decode(data, len, error_msg);
+}
+
+size_t message_encode(MessageHandle handle, uint8_t** out_data, char** error_msg) {
+    return plugin_encode(handle, out_data, error_msg);
+}
+
+void message_free(MessageHandle handle) {
+    plugin_free(handle);
+}
+
+void message_free_data(uint8_t* data) {
+    plugin_free_data(data);
+}
+
+void message_free_error(char* error_msg) {
+    plugin_free_error(error_msg);
+}
+
+// ffire_* — C# and Dart package entry points.
+
+void* ffire_decode(const uint8_t* data, int32_t len) {
+    if (len <= 0) {
+        g_last_error = "Invalid input data";
+        return nullptr;
+    }
+    char* err = nullptr;
+    PluginHandle handle = plugin_decode(data, static_cast<size_t>(len), &err);
+    if (!handle) {
+        set_last_error(err);
+    }
+    return handle;
+}
+
+const uint8_t* ffire_encode(void* msg) {
+    char* err = nullptr;
+    uint8_t* data = nullptr;
+    size_t len = plugin_encode(msg, &data, &err);
+    if (!data) {
+        set_last_error(err);
+        return nullptr;
+    }
+    // The bindings expect one buffer leading with a u32 payload length.
+    g_encode_buf.resize(4 + len);
+    uint32_t len32 = static_cast<uint32_t>(len);
+    std::memcpy(g_encode_buf.data(), &len32, 4);
+    std::memcpy(g_encode_buf.data() + 4, data, len);
+    plugin_free_data(data);
+    return g_encode_buf.data();
+}
+
+void ffire_free(void* msg) {
+    plugin_free(msg);
+}
+
+const char* ffire_get_error(void) {
+    return g_last_error.empty() ? nullptr : g_last_error.c_str();
+}
+
+} // extern "C"
@@ -0,0 +1,76 @@
+// JNI exports for the Java package: com.ffire.test.Message declares
+// static natives that the JVM resolves against these names. Compiled only
+// when the build points at a JDK (make JAVA_HOME=/path/to/jdk), so the
+// core runtime keeps building without one.
+#include "generated_c.h"
+#include <jni.h>
+#include <string>
+
+namespace {
+
+// Java polls messageGetError after a failed call on the same thread.
+thread_local std::string g_last_error;
+
+void set_last_error(char* error_msg) {
+    g_last_error = error_msg ? error_msg : "Unknown error";
+    plugin_free_error(error_msg);
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL Java_com_ffire_test_Message_messageDecode(
+    JNIEnv* env, jclass, jbyteArray data, jint size) {
+    if (!data || size <= 0) {
+        g_last_error = "Invalid input data";
+        return 0;
+    }
+    jbyte* bytes = env->GetByteArrayElements(data, nullptr);
+    if (!bytes) {
+        g_last_error = "Failed to pin input array";
+        return 0;
+    }
+    char* err = nullptr;
+    PluginHandle handle = plugin_decode(reinterpret_cast<const uint8_t*>(bytes),
+                                        static_cast<size_t>(size), &err);
+    env->ReleaseByteArrayElements(data, bytes, JNI_ABORT);
+    if (!handle) {
+        set_last_error(err);
+        return 0;
+    }
+    return reinterpret_cast<jlong>(handle);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_ffire_test_Message_messageEncode(
+    JNIEnv* env, jclass, jlong handle) {
+    char* err = nullptr;
+    uint8_t* data = nullptr;
+    size_t len = plugin_encode(reinterpret_cast<PluginHandle>(handle), &data, &err);
+    if (!data) {
+        set_last_error(err);
+        return nullptr;
+    }
+    jbyteArray result = env->NewByteArray(static_cast<jsize>(len));
+    if (result) {
+        env->SetByteArrayRegion(result, 0, static_cast<jsize>(len),
+                                reinterpret_cast<const jbyte*>(data));
+    } else {
+        g_last_error = "Failed to allocate result array";
+    }
+    plugin_free_data(data);
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_ffire_test_Message_messageFree(
+    JNIEnv*, jclass, jlong handle) {
+    plugin_free(reinterpret_cast<PluginHandle>(handle));
+}
+
+JNIEXPORT jstring JNICALL Java_com_ffire_test_Message_messageGetError(
+    JNIEnv* env, jclass) {
+    return env->NewStringUTF(g_last_error.empty() ? "Unknown error"
+                                                  : g_last_error.c_str());
+}
+
+} // extern "C"
@@ -0,0 +1,321 @@
+// Micro-benchmark suite for the ffire C++ runtime and C ABI.
+//
+// Replaces the fixed 100-iteration timing loop in 03-cpp-dynamic/test.cpp as
+// the performance signal: catalogs are generated at several sizes, string
+// length profiles, and optional-field densities, and each operation (encode,
+// decode, roundtrip, field access, C-ABI decode) is timed adaptively and
+// reported as ns/op, MB/s, and allocations/op in JSON.
+//
+//   ./bench                          run and print JSON to stdout
+//   ./bench --write-baseline FILE    run and store results as the baseline
+//   ./bench --check FILE             run and fail when ns/op regresses more
+//                                    than 30% against the stored baseline
+//
+// The baseline is machine-local, like the numbers in RESULTS.md; refresh it
+// with --write-baseline after intentional performance changes.
+#include "../common/generated.hpp"
+#include "../common/generated_c.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Allocation counting: every global new/delete bumps a counter, so each
+// benchmark can report allocations per operation alongside time.
+
+static size_t g_alloc_count = 0;
+
+void* operator new(size_t size) {
+    ++g_alloc_count;
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// ---------------------------------------------------------------------------
+// Synthetic catalog generation. Deterministic (seeded xorshift), so every
+// run and every machine benchmarks identical messages.
+
+struct CatalogSpec {
+    size_t parameters;        // total across all plugins, 100 per plugin
+    size_t string_len;        // mean length of generated strings
+    double optional_density;  // fraction of parameters with indexed values
+};
+
+static uint32_t g_rng = 0x9E3779B9;
+
+static uint32_t next_rand() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+static std::string make_string(size_t mean_len) {
+    // Lengths spread around the mean (+/- 50%) over a small alphabet.
+    size_t len = mean_len / 2 + next_rand() % (mean_len + 1);
+    std::string s;
+    s.reserve(len);
+    for (size_t i = 0; i < len; i++) {
+        s.push_back(static_cast<char>('a' + next_rand() % 26));
+    }
+    return s;
+}
+
+static std::vector<test::Plugin> make_catalog(const CatalogSpec& spec) {
+    g_rng = 0x9E3779B9;  // identical catalog for every run
+    size_t per_plugin = spec.parameters < 100 ? spec.parameters : 100;
+    size_t plugin_count = (spec.parameters + per_plugin - 1) / per_plugin;
+    std::vector<test::Plugin> catalog(plugin_count);
+    size_t remaining = spec.parameters;
+    for (auto& plugin : catalog) {
+        plugin.Name = make_string(spec.string_len);
+        plugin.ManufacturerID = make_string(4);
+        plugin.Type = make_string(4);
+        plugin.Subtype = make_string(4);
+        size_t count = remaining < per_plugin ? remaining : per_plugin;
+        remaining -= count;
+        plugin.Parameters.resize(count);
+        for (auto& param : plugin.Parameters) {
+            param.DisplayName = make_string(spec.string_len);
+            param.Unit = make_string(spec.string_len / 4 + 1);
+            param.Identifier = make_string(spec.string_len);
+            param.DefaultValue = static_cast<float>(next_rand() % 1000) / 1000.0f;
+            param.CurrentValue = static_cast<float>(next_rand() % 1000) / 1000.0f;
+            param.MinValue = 0.0f;
+            param.MaxValue = 1.0f;
+            param.Address = static_cast<int32_t>(next_rand() % 100000);
+            param.RawFlags = next_rand();
+            param.CanRamp = (next_rand() & 1) != 0;
+            param.IsWritable = (next_rand() & 1) != 0;
+            if (next_rand() % 1000 <
+                static_cast<uint32_t>(spec.optional_density * 1000)) {
+                std::vector<std::string> values;
+                for (size_t v = 0; v < 4; v++) {
+                    values.push_back(make_string(spec.string_len / 2 + 1));
+                }
+                param.IndexedValues = std::move(values);
+                param.IndexedValuesSource = make_string(spec.string_len);
+            }
+        }
+    }
+    return catalog;
+}
+
+// ---------------------------------------------------------------------------
+// Timing harness: calibrate the iteration count toward a ~100 ms window,
+// then report the timed region per operation.
+
+struct BenchResult {
+    double ns_op = 0.0;
+    double mb_s = 0.0;
+    double allocs_op = 0.0;
+};
+
+template <typename F>
+static BenchResult run_bench(F&& fn, size_t bytes_per_op) {
+    using clock = std::chrono::steady_clock;
+    // Warmup and calibration.
+    auto t0 = clock::now();
+    fn();
+    double once_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0)
+            .count());
+    size_t iters = once_ns > 0 ? static_cast<size_t>(100e6 / once_ns) : 1000000;
+    if (iters < 10) iters = 10;
+    if (iters > 1000000) iters = 1000000;
+
+    size_t allocs_before = g_alloc_count;
+    auto start = clock::now();
+    for (size_t i = 0; i < iters; i++) {
+        fn();
+    }
+    auto stop = clock::now();
+    size_t allocs = g_alloc_count - allocs_before;
+
+    double total_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+    BenchResult r;
+    r.ns_op = total_ns / static_cast<double>(iters);
+    r.mb_s = r.ns_op > 0
+                 ? (static_cast<double>(bytes_per_op) * 1e9 / r.ns_op) / 1e6
+                 : 0.0;
+    r.allocs_op = static_cast<double>(allocs) / static_cast<double>(iters);
+    return r;
+}
+
+struct Entry {
+    std::string id;
+    BenchResult result;
+    size_t bytes;
+};
+
+// Consume decoded values so field access cannot be optimized away.
+static volatile double g_sink = 0.0;
+
+static void bench_case(std::vector<Entry>& out, const std::string& label,
+                       const CatalogSpec& spec, bool full_matrix) {
+    auto catalog = make_catalog(spec);
+    auto encoded = test::encode_plugin_message(catalog);
+    size_t bytes = encoded.size();
+
+    auto add = [&](const char* op, const BenchResult& r) {
+        out.push_back({label + "/" + op, r, bytes});
+    };
+
+    add("decode", run_bench(
+                      [&] {
+                          auto msg = test::decode_plugin_message(encoded);
+                          g_sink += static_cast<double>(msg.size());
+                      },
+                      bytes));
+    if (!full_matrix) {
+        return;
+    }
+    add("encode", run_bench(
+                      [&] {
+                          auto buf = test::encode_plugin_message(catalog);
+                          g_sink += static_cast<double>(buf.size());
+                      },
+                      bytes));
+    add("roundtrip", run_bench(
+                         [&] {
+                             auto msg = test::decode_plugin_message(encoded);
+                             auto buf = test::encode_plugin_message(msg);
+                             g_sink += static_cast<double>(buf.size());
+                         },
+                         bytes));
+
+    auto decoded = test::decode_plugin_message(encoded);
+    add("access", run_bench(
+                      [&] {
+                          double sum = 0.0;
+                          size_t chars = 0;
+                          for (const auto& plugin : decoded) {
+                              chars += plugin.Name.size();
+                              for (const auto& param : plugin.Parameters) {
+                                  sum += param.CurrentValue;
+                                  sum += param.DefaultValue;
+                                  chars += param.DisplayName.size();
+                                  chars += param.Identifier.size();
+                              }
+                          }
+                          g_sink += sum + static_cast<double>(chars);
+                      },
+                      bytes));
+
+    add("c_decode", run_bench(
+                        [&] {
+                            char* error = nullptr;
+                            PluginHandle h =
+                                plugin_decode(encoded.data(), encoded.size(), &error);
+                            g_sink += plugin_get_plugins_count(h);
+                            plugin_free(h);
+                        },
+                        bytes));
+}
+
+// ---------------------------------------------------------------------------
+// JSON output and baseline comparison. The baseline is a flat map of case id
+// to ns/op, written by --write-baseline and scanned with plain string search
+// so no JSON dependency is needed.
+
+static void print_json(std::ostream& os, const std::vector<Entry>& entries) {
+    os << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry& e = entries[i];
+        char buf[256];
+        std::snprintf(buf, sizeof(buf),
+                      "    {\"id\": \"%s\", \"bytes\": %zu, \"ns_op\": %.1f, "
+                      "\"mb_s\": %.1f, \"allocs_op\": %.2f}%s\n",
+                      e.id.c_str(), e.bytes, e.result.ns_op, e.result.mb_s,
+                      e.result.allocs_op, i + 1 < entries.size() ? "," : "");
+        os << buf;
+    }
+    os << "  ]\n}\n";
+}
+
+static bool read_baseline_ns(const std::string& content, const std::string& id,
+                             double* out) {
+    std::string key = "\"id\": \"" + id + "\"";
+    size_t at = content.find(key);
+    if (at == std::string::npos) return false;
+    size_t ns = content.find("\"ns_op\": ", at);
+    if (ns == std::string::npos) return false;
+    *out = std::atof(content.c_str() + ns + 9);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* baseline_path = nullptr;
+    bool write_baseline = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--write-baseline") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+            write_baseline = true;
+        } else if (std::strcmp(argv[i], "--check") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else {
+            std::cerr << "usage: bench [--write-baseline FILE | --check FILE]\n";
+            return 2;
+        }
+    }
+
+    std::vector<Entry> entries;
+    // Size sweep with the default profile, full operation matrix.
+    for (size_t params : {size_t(1), size_t(100), size_t(10000), size_t(65000)}) {
+        std::string label = "params_" + std::to_string(params);
+        bench_case(entries, label, {params, 16, 0.3}, true);
+    }
+    // String length and optional density variants, decode only: the walk
+    // shape is identical, so decode is where the distribution shows up.
+    bench_case(entries, "strings_short", {10000, 4, 0.3}, false);
+    bench_case(entries, "strings_long", {10000, 64, 0.3}, false);
+    bench_case(entries, "optionals_none", {10000, 16, 0.0}, false);
+    bench_case(entries, "optionals_dense", {10000, 16, 0.9}, false);
+
+    print_json(std::cout, entries);
+
+    if (write_baseline) {
+        std::ofstream out(baseline_path);
+        print_json(out, entries);
+        std::cerr << "baseline written to " << baseline_path << "\n";
+        return 0;
+    }
+    if (baseline_path) {
+        std::ifstream in(baseline_path);
+        if (!in) {
+            std::cerr << "cannot open baseline " << baseline_path << "\n";
+            return 2;
+        }
+        std::stringstream ss;
+        ss << in.rdbuf();
+        std::string content = ss.str();
+        int regressions = 0;
+        for (const Entry& e : entries) {
+            double base_ns = 0.0;
+            if (!read_baseline_ns(content, e.id, &base_ns)) continue;
+            if (e.result.ns_op > base_ns * 1.30) {
+                std::cerr << "REGRESSION " << e.id << ": " << e.result.ns_op
+                          << " ns/op vs baseline " << base_ns << "\n";
+                ++regressions;
+            }
+        }
+        if (regressions > 0) {
+            std::cerr << regressions << " regression(s) against " << baseline_path
+                      << "\n";
+            return 1;
+        }
+        std::cerr << "no regressions against " << baseline_path << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/bin/bash
+set -e
+
+echo "=== bench: ffire C++ runtime micro-benchmarks ==="
+echo ""
+
+echo "=== Building ==="
+make > /dev/null
+
+if [ -f baseline.json ]; then
+    echo ""
+    echo "=== Running against stored baseline ==="
+    ./bench --check baseline.json | tee bench.json
+else
+    echo ""
+    echo "=== No baseline found, writing one ==="
+    ./bench --write-baseline baseline.json | tee bench.json
+fi
+
+echo ""
+echo "✓ Bench complete"
@@ -15,10 +15,78 @@ typedef void* PluginHandle;
 // Returns NULL on error
 PluginHandle plugin_decode(const uint8_t* data, size_t len, char** error_msg);
 
+// Decode into an existing handle, replacing its contents and reusing its
+// retained arena capacity so steady-state decode loops reach zero
+// allocations. Returns 1 on success, 0 on error (the handle stays valid
+// but empty and can be decoded into again).
+int plugin_decode_into(PluginHandle handle, const uint8_t* data, size_t len, char** error_msg);
+
+// Hint the arena capacity to retain for future plugin_decode_into calls.
+void plugin_reserve(PluginHandle handle, size_t plugins, size_t params_per_plugin);
+
+// Memory-map an encoded catalog file and decode it lazily: each plugin
+// record is materialized on first access, so reading a few fields from a
+// large catalog touches only the pages holding those records. The mapping
+// is released by plugin_free (or by the next plugin_decode_into).
+// Returns NULL on error.
+PluginHandle plugin_open_mapped(const char* path, char** error_msg);
+
+// Asynchronous decode on an internal worker pool, so large catalog decodes
+// never block the calling (UI) thread. The input buffer is copied before
+// plugin_decode_async returns, so the caller may free it immediately. The
+// callback runs on a worker thread with either a finished handle (the
+// caller owns it; free with plugin_free) or an error message valid only
+// for the duration of the call — never both. Returns a nonzero job id, or
+// 0 when the job could not be queued.
+typedef void (*FfireDecodeCallback)(PluginHandle handle, const char* error_msg,
+                                    void* user_data);
+
+uint64_t plugin_decode_async(const uint8_t* data, size_t len,
+                             FfireDecodeCallback callback, void* user_data);
+
+// Cancel a pending or running async decode. Decoding is chunked per record,
+// so running jobs stop at the next record boundary. Returns 1 when the job
+// was cancelled and its callback is guaranteed not to run, 0 when the job
+// already completed (or the id is unknown).
+int plugin_decode_cancel(uint64_t job_id);
+
 // Encode a Plugin to binary data
 // Returns the size of the encoded data, or 0 on error
 size_t plugin_encode(PluginHandle handle, uint8_t** out_data, char** error_msg);
 
+// Encode a Plugin, transferring ownership of the buffer to the caller.
+// Unlike plugin_encode, nothing is retained on the handle and no second
+// copy is made. Free the buffer with plugin_free_data.
+// Returns the size of the encoded data, or 0 on error
+size_t plugin_encode_release(PluginHandle handle, uint8_t** out_data, char** error_msg);
+
+// Encode a Plugin into a caller-provided buffer of `cap` bytes, for reuse
+// across frames. Returns the exact encoded size; the buffer is only
+// written when `cap` is large enough, otherwise error_msg is set and the
+// returned size tells the caller how much to allocate. Returns 0 on error.
+size_t plugin_encode_into(PluginHandle handle, uint8_t* buf, size_t cap, char** error_msg);
+
+// Real-time value channel: a fixed-capacity lock-free single-producer/
+// single-consumer ring of (address, value) records. plugin_rt_push_value is
+// wait-free and never allocates or locks, so it is safe on the audio
+// thread; it drops the update and returns 0 when the ring is full. Drain on
+// any other single thread with plugin_rt_drain, which patches CurrentValue
+// for every parameter whose address matches (last writer wins) and returns
+// the number of writes applied.
+typedef void* ValueRingHandle;
+
+ValueRingHandle plugin_rt_ring_create(size_t capacity);
+void plugin_rt_ring_free(ValueRingHandle ring);
+int plugin_rt_push_value(ValueRingHandle ring, int32_t address, float value);
+size_t plugin_rt_drain(ValueRingHandle ring, PluginHandle handle);
+
+// Patch the handle's decoded catalog in place with a delta produced by
+// diff_plugin_message (u32 record count, then fixed-size field updates).
+// Only scalar and flag fields change, so applying a delta allocates
+// nothing. Returns 1 on success, 0 on error (malformed delta or indices
+// that do not fit the catalog; the catalog may be partially updated).
+int plugin_apply_delta(PluginHandle handle, const uint8_t* data, size_t len, char** error_msg);
+
 // Free a Plugin handle
 void plugin_free(PluginHandle handle);
 
@@ -35,6 +103,94 @@ const char* plugin_get_type(PluginHandle handle);
 const char* plugin_get_subtype(PluginHandle handle);
 size_t plugin_get_parameters_count(PluginHandle handle);
 
+// Pointer+length variants of the string getters. Each fills the caller's
+// out-params with a view into the handle's storage — no strlen at the
+// crossing, no copy — so bindings can build no-copy strings directly.
+// Views stay valid exactly as long as the matching char* getter's result.
+// Returns 1 on success, 0 when the handle or field is absent.
+int plugin_get_name_view(PluginHandle handle, const char** out_data, size_t* out_len);
+int plugin_get_manufacturer_id_view(PluginHandle handle, const char** out_data, size_t* out_len);
+int plugin_get_type_view(PluginHandle handle, const char** out_data, size_t* out_len);
+int plugin_get_subtype_view(PluginHandle handle, const char** out_data, size_t* out_len);
+
+// Plain-data snapshot of one Parameter: scalar fields by value, strings as
+// pointer+length pairs into the handle's storage (valid while the plugin
+// handle is). Filled in a single FFI crossing instead of 13+ getter calls.
+typedef struct {
+    const char* display_name;
+    size_t display_name_len;
+    const char* unit;
+    size_t unit_len;
+    const char* identifier;
+    size_t identifier_len;
+    float default_value;
+    float current_value;
+    float max_value;
+    float min_value;
+    int32_t address;
+    int64_t raw_flags;
+    int can_ramp;      // 1 for true, 0 for false
+    int is_writable;
+    size_t indexed_values_count;        // 0 when not present
+    const char* indexed_values_source;  // NULL when not present
+    size_t indexed_values_source_len;
+} FfireParameterData;
+
+// Fill `out` with parameter `index` in one call
+// Returns 1 on success, 0 on error
+int plugin_get_parameter_data(PluginHandle handle, size_t index, FfireParameterData* out);
+
+// Fill `out_array` with `count` parameters starting at `start`
+// Returns the number of entries written (may be less than count at the end)
+size_t plugin_get_parameters_bulk(PluginHandle handle, size_t start, size_t count,
+                                  FfireParameterData* out_array);
+
+// Native message builder, for producers that construct catalogs directly
+// instead of decoding one. plugin_create returns a handle holding a single
+// empty plugin; plugin_append_plugin starts another. The setters and
+// plugin_add_parameter target the most recently started plugin and adopt
+// every string into the handle's arena in one copy, so building and
+// encoding a catalog needs no intermediate format. Built handles encode
+// through the plugin_encode family and read back through every getter.
+// All builder calls return 1 on success, 0 on error.
+PluginHandle plugin_create(void);
+int plugin_append_plugin(PluginHandle handle);
+int plugin_set_name(PluginHandle handle, const char* data, size_t len);
+int plugin_set_manufacturer_id(PluginHandle handle, const char* data, size_t len);
+int plugin_set_type(PluginHandle handle, const char* data, size_t len);
+int plugin_set_subtype(PluginHandle handle, const char* data, size_t len);
+
+// Append one parameter built from `data`. String fields are read as the
+// pointer+length pairs; indexed_values_count is ignored — append the
+// values afterwards with plugin_add_indexed_value.
+int plugin_add_parameter(PluginHandle handle, const FfireParameterData* data);
+
+// Append an indexed value to the most recently added parameter.
+int plugin_add_indexed_value(PluginHandle handle, const char* data, size_t len);
+
+// Raw column pointers over every parameter in the handle, in message order
+// across all plugins. Columns are contiguous per field, so scans over the
+// numeric values (metering, range checks) can vectorize directly. Pointers
+// stay valid until the handle is freed or decoded into again.
+typedef struct {
+    size_t parameter_count;
+    const uint32_t* parameters_first;  // per plugin: first index into columns
+    const uint32_t* parameters_count;  // per plugin: number of parameters
+    size_t plugin_count;
+    const float* default_value;
+    const float* current_value;
+    const int32_t* address;
+    const float* max_value;
+    const float* min_value;
+    const int64_t* raw_flags;
+    const uint8_t* can_ramp;      // 1 / 0 per parameter
+    const uint8_t* is_writable;
+} FfireParameterColumns;
+
+// Fill `out` with the handle's parameter columns, building them on first
+// call after a decode. Returns 1 on success, 0 on error.
+int plugin_get_parameter_columns(PluginHandle handle, FfireParameterColumns* out);
+
 // Opaque handle for Parameter struct
 typedef void* ParameterHandle;
 
@@ -54,12 +210,76 @@ int parameter_get_can_ramp(ParameterHandle handle);  // Returns 1 for true, 0 fo
 int parameter_get_is_writable(ParameterHandle handle);
 int64_t parameter_get_raw_flags(ParameterHandle handle);
 
+// Pointer+length variants (see plugin_get_name_view)
+int parameter_get_display_name_view(ParameterHandle handle, const char** out_data, size_t* out_len);
+int parameter_get_unit_view(ParameterHandle handle, const char** out_data, size_t* out_len);
+int parameter_get_identifier_view(ParameterHandle handle, const char** out_data, size_t* out_len);
+
 // Optional array getter (returns count, or 0 if not present)
 size_t parameter_get_indexed_values_count(ParameterHandle handle);
 const char* parameter_get_indexed_value(ParameterHandle handle, size_t index);
+int parameter_get_indexed_value_view(ParameterHandle handle, size_t index,
+                                     const char** out_data, size_t* out_len);
 
 // Optional string getter (returns NULL if not present)
 const char* parameter_get_indexed_values_source(ParameterHandle handle);
+int parameter_get_indexed_values_source_view(ParameterHandle handle,
+                                             const char** out_data, size_t* out_len);
+
+// Index-based direct getters. These address any plugin/parameter in the
+// handle without creating intermediate handles, so iterating a full
+// catalog performs zero heap allocations in the bridge layer.
+size_t plugin_get_plugins_count(PluginHandle handle);
+size_t plugin_get_parameters_count_at(PluginHandle handle, size_t plugin_idx);
+const char* plugin_parameter_get_display_name(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+float plugin_parameter_get_default_value(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+float plugin_parameter_get_current_value(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+int32_t plugin_parameter_get_address(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+float plugin_parameter_get_max_value(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+float plugin_parameter_get_min_value(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+const char* plugin_parameter_get_unit(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+const char* plugin_parameter_get_identifier(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+int plugin_parameter_get_can_ramp(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+int plugin_parameter_get_is_writable(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+int64_t plugin_parameter_get_raw_flags(PluginHandle handle, size_t plugin_idx, size_t param_idx);
+
+// O(1) lookup by Parameter Identifier or Address across the whole message.
+// On a hit, writes the plugin/parameter indexes (usable with the direct
+// getters above) and returns 1; returns 0 when not found. The first match
+// in message order wins when identifiers or addresses repeat. The index is
+// built lazily on first lookup and rebuilt after any decode, delta apply,
+// or builder mutation; draining a value ring does not invalidate it.
+int plugin_find_parameter_by_identifier(PluginHandle handle, const char* identifier,
+                                        size_t len, size_t* plugin_idx, size_t* param_idx);
+int plugin_find_parameter_by_address(PluginHandle handle, int32_t address,
+                                     size_t* plugin_idx, size_t* param_idx);
+
+// Hot-path instrumentation snapshot, compiled in when the library is built
+// with -DFFIRE_ENABLE_STATS (zero cost otherwise). Counters are cumulative
+// per handle since creation.
+typedef struct {
+    uint64_t messages_decoded;
+    uint64_t bytes_decoded;
+    uint64_t messages_encoded;
+    uint64_t bytes_encoded;
+    uint64_t alloc_count;       // heap allocations beyond the retained arena
+    uint64_t arena_high_water;  // retained arena size in bytes
+    uint64_t last_decode_ns;    // wall time of the most recent decode
+    uint64_t total_decode_ns;
+} FfireStats;
+
+// Fill `out` with the handle's counters. Returns 1 when the library was
+// built with FFIRE_ENABLE_STATS, 0 (with `out` zeroed) when it was not, so
+// metrics pipelines can detect availability at runtime.
+int plugin_get_stats(PluginHandle handle, FfireStats* out);
+
+// Pointer+length variants (see plugin_get_name_view)
+int plugin_parameter_get_display_name_view(PluginHandle handle, size_t plugin_idx, size_t param_idx,
+                                           const char** out_data, size_t* out_len);
+int plugin_parameter_get_unit_view(PluginHandle handle, size_t plugin_idx, size_t param_idx,
+                                   const char** out_data, size_t* out_len);
+int plugin_parameter_get_identifier_view(PluginHandle handle, size_t plugin_idx, size_t param_idx,
+                                         const char** out_data, size_t* out_len);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,125 @@
+// C++ driver for the FFI overhead harness: calls the C ABI through the
+// shared library, so the numbers include the same dynamic dispatch every
+// other language pays but none of their bridge cost. This is the floor the
+// managed drivers are compared against.
+#include "../common/generated_c.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static std::vector<uint8_t> load_fixture(const char* path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Cannot open fixture file");
+    }
+    size_t size = file.tellg();
+    file.seekg(0);
+    std::vector<uint8_t> buffer(size);
+    file.read(reinterpret_cast<char*>(buffer.data()), size);
+    return buffer;
+}
+
+static volatile double g_sink = 0.0;
+
+template <typename F>
+static double bench_ns(F&& fn) {
+    using clock = std::chrono::steady_clock;
+    // Calibrate toward a ~50 ms window.
+    auto t0 = clock::now();
+    fn();
+    double once = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0)
+            .count());
+    size_t iters = once > 0 ? static_cast<size_t>(50e6 / once) : 1000000;
+    if (iters < 10) iters = 10;
+    if (iters > 10000000) iters = 10000000;
+    auto start = clock::now();
+    for (size_t i = 0; i < iters; i++) {
+        fn();
+    }
+    auto stop = clock::now();
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                   .count()) /
+           static_cast<double>(iters);
+}
+
+int main() {
+    auto data = load_fixture("../common/complex.bin");
+    char* error = nullptr;
+    PluginHandle h = plugin_decode(data.data(), data.size(), &error);
+    if (!h) {
+        std::cerr << "Decode error: " << (error ? error : "unknown") << "\n";
+        return 1;
+    }
+    struct Entry {
+        const char* id;
+        double ns_op;
+    };
+    std::vector<Entry> entries;
+
+    entries.push_back({"handle_lifecycle", bench_ns([&] {
+                           char* err = nullptr;
+                           PluginHandle tmp =
+                               plugin_decode(data.data(), data.size(), &err);
+                           plugin_free(tmp);
+                       })});
+
+    entries.push_back({"getter_scalar", bench_ns([&] {
+                           g_sink += plugin_parameter_get_current_value(h, 0, 0);
+                       })});
+
+    entries.push_back({"getter_string", bench_ns([&] {
+                           const char* s = plugin_parameter_get_identifier(h, 0, 0);
+                           g_sink += static_cast<double>(s[0]);
+                       })});
+
+    entries.push_back({"getter_string_view", bench_ns([&] {
+                           const char* s = nullptr;
+                           size_t n = 0;
+                           plugin_parameter_get_identifier_view(h, 0, 0, &s, &n);
+                           g_sink += static_cast<double>(n);
+                       })});
+
+    // Both sweeps cover the first plugin's parameters: that is the record
+    // plugin_get_parameters_bulk addresses, so the ratio is apples to apples.
+    size_t params0 = plugin_get_parameters_count_at(h, 0);
+    entries.push_back({"sweep_scalar", bench_ns([&] {
+                           double sum = 0.0;
+                           for (size_t i = 0; i < params0; i++) {
+                               sum += plugin_parameter_get_current_value(h, 0, i);
+                               sum += plugin_parameter_get_default_value(h, 0, i);
+                               sum += plugin_parameter_get_address(h, 0, i);
+                           }
+                           g_sink += sum;
+                       })});
+
+    std::vector<FfireParameterData> bulk(params0);
+    entries.push_back({"sweep_bulk", bench_ns([&] {
+                           double sum = 0.0;
+                           size_t got = plugin_get_parameters_bulk(
+                               h, 0, bulk.size(), bulk.data());
+                           for (size_t i = 0; i < got; i++) {
+                               sum += bulk[i].current_value;
+                               sum += bulk[i].default_value;
+                               sum += bulk[i].address;
+                           }
+                           g_sink += sum;
+                       })});
+
+    std::cout << "{\"lang\": \"cpp\", \"benchmarks\": [";
+    for (size_t i = 0; i < entries.size(); i++) {
+        char buf[128];
+        std::snprintf(buf, sizeof(buf), "%s{\"id\": \"%s\", \"ns_op\": %.1f}",
+                      i ? ", " : "", entries[i].id, entries[i].ns_op);
+        std::cout << buf;
+    }
+    std::cout << "]}\n";
+
+    plugin_free(h);
+    return 0;
+}
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Python driver for the FFI overhead harness: the same benchmark ids as
+bench_cpp.cpp through ctypes, the highest-overhead bridge we ship.
+"""
+import ctypes
+import json
+import os
+import platform
+import time
+
+libname = './libffire.dylib' if platform.system() == 'Darwin' else './libffire.so'
+if not os.path.exists(libname):
+    import subprocess
+    subprocess.run(['make'], check=True)
+
+lib = ctypes.CDLL(libname)
+
+PluginHandle = ctypes.c_void_p
+
+
+class FfireParameterData(ctypes.Structure):
+    _fields_ = [
+        ("display_name", ctypes.c_char_p),
+        ("display_name_len", ctypes.c_size_t),
+        ("unit", ctypes.c_char_p),
+        ("unit_len", ctypes.c_size_t),
+        ("identifier", ctypes.c_char_p),
+        ("identifier_len", ctypes.c_size_t),
+        ("default_value", ctypes.c_float),
+        ("current_value", ctypes.c_float),
+        ("max_value", ctypes.c_float),
+        ("min_value", ctypes.c_float),
+        ("address", ctypes.c_int32),
+        ("raw_flags", ctypes.c_int64),
+        ("can_ramp", ctypes.c_int),
+        ("is_writable", ctypes.c_int),
+        ("indexed_values_count", ctypes.c_size_t),
+        ("indexed_values_source", ctypes.c_char_p),
+        ("indexed_values_source_len", ctypes.c_size_t),
+    ]
+
+
+lib.plugin_decode.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t,
+                              ctypes.POINTER(ctypes.c_char_p)]
+lib.plugin_decode.restype = PluginHandle
+lib.plugin_free.argtypes = [PluginHandle]
+lib.plugin_free.restype = None
+lib.plugin_get_plugins_count.argtypes = [PluginHandle]
+lib.plugin_get_plugins_count.restype = ctypes.c_size_t
+lib.plugin_get_parameters_count_at.argtypes = [PluginHandle, ctypes.c_size_t]
+lib.plugin_get_parameters_count_at.restype = ctypes.c_size_t
+lib.plugin_parameter_get_current_value.argtypes = [PluginHandle, ctypes.c_size_t, ctypes.c_size_t]
+lib.plugin_parameter_get_current_value.restype = ctypes.c_float
+lib.plugin_parameter_get_default_value.argtypes = [PluginHandle, ctypes.c_size_t, ctypes.c_size_t]
+lib.plugin_parameter_get_default_value.restype = ctypes.c_float
+lib.plugin_parameter_get_address.argtypes = [PluginHandle, ctypes.c_size_t, ctypes.c_size_t]
+lib.plugin_parameter_get_address.restype = ctypes.c_int32
+lib.plugin_parameter_get_identifier.argtypes = [PluginHandle, ctypes.c_size_t, ctypes.c_size_t]
+lib.plugin_parameter_get_identifier.restype = ctypes.c_char_p  # ctypes copies here
+lib.plugin_parameter_get_identifier_view.argtypes = [
+    PluginHandle, ctypes.c_size_t, ctypes.c_size_t,
+    ctypes.POINTER(ctypes.c_void_p), ctypes.POINTER(ctypes.c_size_t)]
+lib.plugin_parameter_get_identifier_view.restype = ctypes.c_int
+lib.plugin_get_parameters_bulk.argtypes = [PluginHandle, ctypes.c_size_t, ctypes.c_size_t,
+                                           ctypes.POINTER(FfireParameterData)]
+lib.plugin_get_parameters_bulk.restype = ctypes.c_size_t
+
+with open('../common/complex.bin', 'rb') as f:
+    data = f.read()
+data_array = (ctypes.c_uint8 * len(data)).from_buffer_copy(data)
+
+
+def bench_ns(fn):
+    """Adaptive timing toward a ~50 ms window, reported as ns per call."""
+    start = time.perf_counter()
+    fn()
+    once = time.perf_counter() - start
+    iters = max(10, min(1_000_000, int(0.05 / once) if once > 0 else 1_000_000))
+    start = time.perf_counter()
+    for _ in range(iters):
+        fn()
+    elapsed = time.perf_counter() - start
+    return elapsed * 1e9 / iters
+
+
+error = ctypes.c_char_p()
+handle = lib.plugin_decode(data_array, len(data), ctypes.byref(error))
+assert handle, error.value
+plugins = lib.plugin_get_plugins_count(handle)
+param_counts = [lib.plugin_get_parameters_count_at(handle, p) for p in range(plugins)]
+
+
+def handle_lifecycle():
+    err = ctypes.c_char_p()
+    tmp = lib.plugin_decode(data_array, len(data), ctypes.byref(err))
+    lib.plugin_free(tmp)
+
+
+def getter_scalar():
+    lib.plugin_parameter_get_current_value(handle, 0, 0)
+
+
+def getter_string():
+    lib.plugin_parameter_get_identifier(handle, 0, 0)
+
+
+view_data = ctypes.c_void_p()
+view_len = ctypes.c_size_t()
+
+
+def getter_string_view():
+    lib.plugin_parameter_get_identifier_view(handle, 0, 0,
+                                             ctypes.byref(view_data),
+                                             ctypes.byref(view_len))
+
+
+# Both sweeps cover the first plugin's parameters: that is the record
+# plugin_get_parameters_bulk addresses, so the ratio is apples to apples.
+params0 = param_counts[0]
+
+
+def sweep_scalar():
+    total = 0.0
+    for i in range(params0):
+        total += lib.plugin_parameter_get_current_value(handle, 0, i)
+        total += lib.plugin_parameter_get_default_value(handle, 0, i)
+        total += lib.plugin_parameter_get_address(handle, 0, i)
+    return total
+
+
+bulk = (FfireParameterData * params0)()
+
+
+def sweep_bulk():
+    total = 0.0
+    got = lib.plugin_get_parameters_bulk(handle, 0, len(bulk), bulk)
+    for i in range(got):
+        entry = bulk[i]
+        total += entry.current_value
+        total += entry.default_value
+        total += entry.address
+    return total
+
+
+benchmarks = [
+    ("handle_lifecycle", handle_lifecycle),
+    ("getter_scalar", getter_scalar),
+    ("getter_string", getter_string),
+    ("getter_string_view", getter_string_view),
+    ("sweep_scalar", sweep_scalar),
+    ("sweep_bulk", sweep_bulk),
+]
+
+results = [{"id": name, "ns_op": round(bench_ns(fn), 1)} for name, fn in benchmarks]
+lib.plugin_free(handle)
+
+print(json.dumps({"lang": "python", "benchmarks": results}))
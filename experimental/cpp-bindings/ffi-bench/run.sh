@@ -0,0 +1,19 @@
+#!/bin/bash
+set -e
+
+echo "=== ffi-bench: per-call FFI overhead by language ==="
+echo ""
+
+echo "=== Building ==="
+make > /dev/null
+
+echo ""
+echo "=== C++ (dispatch floor) ==="
+./bench_cpp
+
+echo ""
+echo "=== Python (ctypes) ==="
+python3 bench_python.py
+
+echo ""
+echo "✓ FFI bench complete"
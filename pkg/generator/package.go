@@ -3,7 +3,6 @@ package generator
 import (
 	"fmt"
 	"os"
-	"os/exec"
 	"path/filepath"
 	"runtime"
 	"strings"
@@ -86,7 +85,9 @@ func GeneratePackage(config *PackageConfig) error {
 	}
 }
 
-// generateTierAPackage generates native code + C ABI (no wrapper layer)
+// generateTierAPackage generates native code + C ABI (no wrapper layer).
+// The native sources and library live in the shared runtime directory
+// next to the language packages, not in a per-language copy.
 func generateTierAPackage(config *PackageConfig) error {
 	if config.Verbose {
 		fmt.Println("Generating Tier A package (native code + C ABI)")
@@ -94,39 +95,17 @@ func generateTierAPackage(config *PackageConfig) error {
 
 	// Create directory structure
 	langDir := filepath.Join(config.OutputDir, config.Language)
-	includeDir := filepath.Join(langDir, "include")
-	libDir := filepath.Join(langDir, "lib")
-	srcDir := filepath.Join(langDir, "src")
 	examplesDir := filepath.Join(langDir, "examples")
 
-	for _, dir := range []string{includeDir, libDir, srcDir, examplesDir} {
+	for _, dir := range []string{langDir, examplesDir} {
 		if err := os.MkdirAll(dir, 0755); err != nil {
 			return fmt.Errorf("failed to create directory %s: %w", dir, err)
 		}
 	}
 
-	// Generate C++ header
-	cppCode, err := GenerateCpp(config.Schema)
-	if err != nil {
-		return fmt.Errorf("failed to generate C++ code: %w", err)
-	}
-
-	headerPath := filepath.Join(includeDir, "generated.hpp")
-	if err := os.WriteFile(headerPath, cppCode, 0644); err != nil {
-		return fmt.Errorf("failed to write C++ header: %w", err)
-	}
-	fmt.Printf("✓ Generated C++ code: %s\n", headerPath)
-
-	// Generate C ABI wrapper
-	if err := generateCABI(config, includeDir, srcDir); err != nil {
-		return fmt.Errorf("failed to generate C ABI: %w", err)
-	}
-
-	// Compile dylib (unless --no-compile)
-	if !config.NoCompile {
-		if err := compileDylib(config, srcDir, libDir); err != nil {
-			return fmt.Errorf("failed to compile dylib: %w", err)
-		}
+	// Emit (or reuse) the shared runtime and compile it once
+	if err := generateSharedRuntime(config); err != nil {
+		return err
 	}
 
 	// Generate examples
@@ -237,109 +216,6 @@ func generateCABI(config *PackageConfig, includeDir, srcDir string) error {
 	return nil
 }
 
-// compileDylib compiles the C++ code into a dynamic library
-func compileDylib(config *PackageConfig, srcDir, libDir string) error {
-	if config.Verbose {
-		fmt.Printf("Compiling dylib for platform=%s arch=%s optimize=%d\n",
-			config.Platform, config.Arch, config.Optimize)
-	}
-
-	// Determine compiler and flags based on platform
-	var compiler string
-	var outputFile string
-	var compileFlags []string
-
-	switch config.Platform {
-	case "darwin":
-		compiler = "clang++"
-		outputFile = filepath.Join(libDir, fmt.Sprintf("lib%s.dylib", config.Schema.Package))
-		compileFlags = []string{
-			"-std=c++17",
-			"-dynamiclib",
-			"-fPIC",
-			fmt.Sprintf("-O%d", config.Optimize),
-			"-Wall",
-			"-Wextra",
-		}
-
-		// Add architecture flag for macOS
-		if config.Arch == "arm64" {
-			compileFlags = append(compileFlags, "-arch", "arm64")
-		} else if config.Arch == "x86_64" {
-			compileFlags = append(compileFlags, "-arch", "x86_64")
-		}
-
-	case "linux":
-		compiler = "g++"
-		outputFile = filepath.Join(libDir, fmt.Sprintf("lib%s.so", config.Schema.Package))
-		compileFlags = []string{
-			"-std=c++17",
-			"-shared",
-			"-fPIC",
-			fmt.Sprintf("-O%d", config.Optimize),
-			"-Wall",
-			"-Wextra",
-		}
-
-	case "windows":
-		compiler = "x86_64-w64-mingw32-g++"
-		outputFile = filepath.Join(libDir, fmt.Sprintf("%s.dll", config.Schema.Package))
-		compileFlags = []string{
-			"-std=c++17",
-			"-shared",
-			fmt.Sprintf("-O%d", config.Optimize),
-			"-Wall",
-			"-Wextra",
-		}
-
-	default:
-		return fmt.Errorf("unsupported platform: %s", config.Platform)
-	}
-
-	// Build the command
-	includeDir := filepath.Join(filepath.Dir(srcDir), "include")
-	srcFile := filepath.Join(srcDir, "generated_c.cpp")
-
-	// Convert to absolute paths
-	absIncludeDir, err := filepath.Abs(includeDir)
-	if err != nil {
-		return fmt.Errorf("failed to get absolute path for include dir: %w", err)
-	}
-	absSrcFile, err := filepath.Abs(srcFile)
-	if err != nil {
-		return fmt.Errorf("failed to get absolute path for source file: %w", err)
-	}
-	absOutputFile, err := filepath.Abs(outputFile)
-	if err != nil {
-		return fmt.Errorf("failed to get absolute path for output file: %w", err)
-	}
-
-	args := compileFlags
-	args = append(args, "-I"+absIncludeDir)
-	args = append(args, "-o", absOutputFile)
-	args = append(args, absSrcFile)
-
-	if config.Verbose {
-		fmt.Printf("Running: %s %s\n", compiler, strings.Join(args, " "))
-	}
-
-	// Execute compilation
-	cmd := exec.Command(compiler, args...)
-	// Don't set cmd.Dir - we're using absolute paths
-
-	output, err := cmd.CombinedOutput()
-	if err != nil {
-		return fmt.Errorf("compilation failed: %w\nOutput: %s", err, string(output))
-	}
-
-	if len(output) > 0 && config.Verbose {
-		fmt.Printf("Compiler output:\n%s\n", string(output))
-	}
-
-	fmt.Printf("✓ Compiled dylib: %s\n", outputFile)
-	return nil
-}
-
 // generateExamples generates example code
 func generateExamples(config *PackageConfig, examplesDir string) error {
 	// TODO: Generate language-specific examples
@@ -86,11 +86,11 @@ func setupPackageDirectories(config *PackageConfig, layout DirectoryLayout) (*Pa
 		paths.Package = filepath.Join(paths.Root, "lib", config.Namespace)
 	}
 
-	// Create standard directories
+	// Create standard directories. Include/Src stay computed for layout
+	// callers but are not created: native sources live in the shared
+	// runtime directory, not in the language package.
 	dirsToCreate := []string{
 		paths.Root,
-		paths.Include,
-		paths.Src,
 		paths.Lib,
 	}
 
@@ -114,32 +114,13 @@ func setupPackageDirectories(config *PackageConfig, layout DirectoryLayout) (*Pa
 	return paths, nil
 }
 
-// generateNativeComponents generates C++ header, C ABI, and compiles dylib
+// generateNativeComponents routes the native side of a package to the
+// shared runtime: one set of C++ sources and one compiled library under
+// <OutputDir>/runtime, shared by every language package, instead of a
+// copy per language.
 func generateNativeComponents(config *PackageConfig, paths *PackagePaths) error {
-	// Generate C++ header
-	cppCode, err := GenerateCpp(config.Schema)
-	if err != nil {
-		return fmt.Errorf("failed to generate C++ code: %w", err)
-	}
-
-	headerPath := filepath.Join(paths.Include, "generated.hpp")
-	if err := os.WriteFile(headerPath, cppCode, 0644); err != nil {
-		return fmt.Errorf("failed to write C++ header: %w", err)
-	}
-
-	// Generate C ABI wrapper
-	if err := generateCABI(config, paths.Include, paths.Src); err != nil {
-		return fmt.Errorf("failed to generate C ABI: %w", err)
-	}
-
-	// Compile dylib (unless --no-compile)
-	if !config.NoCompile {
-		if err := compileDylib(config, paths.Src, paths.Lib); err != nil {
-			return fmt.Errorf("failed to compile dylib: %w", err)
-		}
-	}
-
-	return nil
+	_ = paths // the language package itself carries no native files
+	return generateSharedRuntime(config)
 }
 
 // orchestrateTierBPackage is the common orchestration for all Tier B languages
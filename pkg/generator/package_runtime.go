@@ -0,0 +1,213 @@
+package generator
+
+import (
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strings"
+)
+
+// generateSharedRuntime emits the single native runtime every language
+// package links against: <OutputDir>/runtime/ with the C++ header, the C
+// ABI, a Makefile and a README, compiled once into libffire_<schema> plus
+// a "libffire" symlink under the name the bindings load.
+//
+// The source files are only written when they do not exist yet, so
+// regenerating one language package neither duplicates the runtime into
+// that package nor overwrites a runtime that has been synced to newer
+// hand-maintained sources.
+func generateSharedRuntime(config *PackageConfig) error {
+	runtimeDir := filepath.Join(config.OutputDir, "runtime")
+	includeDir := filepath.Join(runtimeDir, "include")
+	srcDir := filepath.Join(runtimeDir, "src")
+
+	for _, dir := range []string{includeDir, srcDir} {
+		if err := os.MkdirAll(dir, 0755); err != nil {
+			return fmt.Errorf("failed to create directory %s: %w", dir, err)
+		}
+	}
+
+	headerPath := filepath.Join(includeDir, "generated.hpp")
+	if _, err := os.Stat(headerPath); err == nil {
+		fmt.Printf("✓ Shared runtime sources exist, keeping: %s\n", runtimeDir)
+	} else {
+		cppCode, err := GenerateCpp(config.Schema)
+		if err != nil {
+			return fmt.Errorf("failed to generate C++ code: %w", err)
+		}
+		if err := os.WriteFile(headerPath, cppCode, 0644); err != nil {
+			return fmt.Errorf("failed to write C++ header: %w", err)
+		}
+		fmt.Printf("✓ Generated C++ code: %s\n", headerPath)
+
+		if err := generateCABI(config, includeDir, srcDir); err != nil {
+			return fmt.Errorf("failed to generate C ABI: %w", err)
+		}
+
+		if err := generateRuntimeMakefile(config, runtimeDir); err != nil {
+			return err
+		}
+		if err := generateRuntimeREADME(config, runtimeDir); err != nil {
+			return err
+		}
+	}
+
+	if !config.NoCompile {
+		if err := compileSharedRuntime(config, runtimeDir); err != nil {
+			return fmt.Errorf("failed to compile shared runtime: %w", err)
+		}
+	}
+
+	return nil
+}
+
+// generateRuntimeMakefile writes the standalone build for consumers that
+// compile the runtime outside the generator (same output names).
+func generateRuntimeMakefile(config *PackageConfig, runtimeDir string) error {
+	content := fmt.Sprintf(`CXX = clang++
+CXXFLAGS = -std=c++17 -O2 -flto -Wall -Wextra -fPIC -pthread -Iinclude
+NAME = libffire_%s
+
+SRCS = $(wildcard src/*.cpp)
+
+UNAME := $(shell uname -s)
+ifeq ($(UNAME),Darwin)
+EXT = dylib
+SHARED = -dynamiclib
+else
+EXT = so
+SHARED = -shared
+endif
+
+LIB = lib/$(NAME).$(EXT)
+COMPAT = lib/libffire.$(EXT)
+
+.PHONY: all clean
+
+all: $(LIB) $(COMPAT)
+
+$(LIB): $(SRCS) $(wildcard include/*.h include/*.hpp)
+	mkdir -p lib
+	$(CXX) $(CXXFLAGS) $(SHARED) -o $(LIB) $(SRCS)
+
+# The language packages load the runtime as plain "libffire"; keep that
+# name resolving to the schema-qualified library.
+$(COMPAT): $(LIB)
+	ln -sf $(NAME).$(EXT) $(COMPAT)
+
+clean:
+	rm -rf lib
+
+.DEFAULT_GOAL := all
+`, config.Schema.Package)
+
+	makefilePath := filepath.Join(runtimeDir, "Makefile")
+	if err := os.WriteFile(makefilePath, []byte(content), 0644); err != nil {
+		return fmt.Errorf("failed to write runtime Makefile: %w", err)
+	}
+	fmt.Printf("✓ Generated runtime Makefile: %s\n", makefilePath)
+	return nil
+}
+
+// generateRuntimeREADME documents the build-once / load-everywhere flow.
+func generateRuntimeREADME(config *PackageConfig, runtimeDir string) error {
+	content := fmt.Sprintf(`# %s - shared native runtime
+
+The single native runtime for the %s schema, linked by every language
+package in this directory's parent. Each language package is a pure
+binding over this library and carries no copy of the C++ sources.
+
+## Building
+
+`+"```bash\nmake\n```"+`
+
+produces lib/libffire_%s.dylib (macOS) or lib/libffire_%s.so (Linux),
+built once with LTO, plus a libffire symlink under the name the language
+packages load at runtime.
+
+## Layout
+
+`+"```"+`
+include/generated.hpp    C++ runtime (header-only)
+include/generated_c.h    stable C ABI all bindings call
+src/generated_c.cpp      C ABI implementation
+`+"```"+`
+`, config.Schema.Package, config.Schema.Package, config.Schema.Package,
+		config.Schema.Package)
+
+	readmePath := filepath.Join(runtimeDir, "README.md")
+	if err := os.WriteFile(readmePath, []byte(content), 0644); err != nil {
+		return fmt.Errorf("failed to write runtime README: %w", err)
+	}
+	fmt.Printf("✓ Generated runtime README: %s\n", readmePath)
+	return nil
+}
+
+// compileSharedRuntime builds every translation unit under src/ into the
+// schema-qualified library and refreshes the "libffire" loader symlink.
+func compileSharedRuntime(config *PackageConfig, runtimeDir string) error {
+	libDir := filepath.Join(runtimeDir, "lib")
+	if err := os.MkdirAll(libDir, 0755); err != nil {
+		return fmt.Errorf("failed to create directory %s: %w", libDir, err)
+	}
+
+	srcFiles, err := filepath.Glob(filepath.Join(runtimeDir, "src", "*.cpp"))
+	if err != nil || len(srcFiles) == 0 {
+		return fmt.Errorf("no runtime sources under %s", runtimeDir)
+	}
+
+	var compiler, ext, shared string
+	switch config.Platform {
+	case "darwin":
+		compiler, ext, shared = "clang++", "dylib", "-dynamiclib"
+	case "linux":
+		compiler, ext, shared = "g++", "so", "-shared"
+	case "windows":
+		compiler, ext, shared = "x86_64-w64-mingw32-g++", "dll", "-shared"
+	default:
+		return fmt.Errorf("unsupported platform: %s", config.Platform)
+	}
+
+	libName := fmt.Sprintf("libffire_%s.%s", config.Schema.Package, ext)
+	outputFile := filepath.Join(libDir, libName)
+
+	args := []string{
+		"-std=c++17",
+		shared,
+		"-fPIC",
+		"-flto",
+		"-pthread",
+		fmt.Sprintf("-O%d", config.Optimize),
+		"-Wall",
+		"-Wextra",
+	}
+	if config.Platform == "darwin" && (config.Arch == "arm64" || config.Arch == "x86_64") {
+		args = append(args, "-arch", config.Arch)
+	}
+	args = append(args, "-I"+filepath.Join(runtimeDir, "include"))
+	args = append(args, "-o", outputFile)
+	args = append(args, srcFiles...)
+
+	if config.Verbose {
+		fmt.Printf("Running: %s %s\n", compiler, strings.Join(args, " "))
+	}
+
+	output, err := exec.Command(compiler, args...).CombinedOutput()
+	if err != nil {
+		return fmt.Errorf("compilation failed: %w\nOutput: %s", err, string(output))
+	}
+
+	// Windows loads by plain file name, so only the unix loaders get the
+	// compat symlink.
+	if config.Platform != "windows" {
+		compatLink := filepath.Join(libDir, "libffire."+ext)
+		os.Remove(compatLink)
+		if err := os.Symlink(libName, compatLink); err != nil {
+			return fmt.Errorf("failed to create loader symlink: %w", err)
+		}
+	}
+
+	fmt.Printf("✓ Compiled shared runtime: %s\n", outputFile)
+	return nil
+}